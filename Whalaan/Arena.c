@@ -0,0 +1,185 @@
+/**
+ * @file: Arena.c
+ * @brief: implementación del alocador por regiones.
+ */
+
+#include <stdint.h>
+#include <sys/mman.h>
+#include "Arena.h"
+
+/**
+ * @fun: AlinearArena(size_t tamanio).
+ * @param tamanio: una cantidad de bytes.
+ * @return: el menor múltiplo de ARENA_ALINEACION mayor o igual a tamanio.
+ */
+size_t AlinearArena(size_t tamanio) {
+    return (tamanio + ARENA_ALINEACION - 1) & ~(size_t)(ARENA_ALINEACION - 1);
+}
+
+/**
+ * @fun: NuevoBloqueArena(size_t tamanio, bool paginas_grandes,
+ *                         EstadisticasArena *estadisticas).
+ * @param tamanio: tamaño en bytes del bloque, cabecera incluida.
+ * @param paginas_grandes: si se intenta respaldar el bloque con páginas
+ * grandes; sólo se hace si el bloque ocupa al menos una.
+ * @param estadisticas: estadísticas de la arena a actualizar.
+ * @brief: pide un bloque al sistema e inicializa su cabecera.
+ * @return: el bloque nuevo; NULL si no hubo memoria.
+ */
+BloqueArena *NuevoBloqueArena(size_t tamanio, bool paginas_grandes,
+                              EstadisticasArena *estadisticas) {
+    BloqueArena *bloque = NULL;
+    bool mapeado = false;
+    bool con_paginas_grandes = false;
+    if (paginas_grandes && tamanio >= ARENA_TAM_PAGINA_GRANDE) {
+        tamanio = (tamanio + ARENA_TAM_PAGINA_GRANDE - 1) &
+                  ~(size_t)(ARENA_TAM_PAGINA_GRANDE - 1);
+        void *memoria = MAP_FAILED;
+#ifdef MAP_HUGETLB
+        // Primero probamos con las páginas grandes reservadas del sistema.
+        memoria = mmap(NULL, tamanio, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        con_paginas_grandes = memoria != MAP_FAILED;
+#endif
+        // Si no hay, usamos páginas normales y pedimos al kernel que las
+        // junte en páginas grandes transparentes.
+        if (memoria == MAP_FAILED) {
+            memoria = mmap(NULL, tamanio, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#ifdef MADV_HUGEPAGE
+            if (memoria != MAP_FAILED) {
+                con_paginas_grandes =
+                        madvise(memoria, tamanio, MADV_HUGEPAGE) == 0;
+            }
+#endif
+        }
+        if (memoria != MAP_FAILED) {
+            bloque = memoria;
+            mapeado = true;
+        }
+    }
+    if (bloque == NULL) {
+        con_paginas_grandes = false;
+        bloque = malloc(tamanio);
+        if (bloque == NULL) return NULL;
+    }
+    bloque->anterior = NULL;
+    bloque->tamanio = tamanio;
+    bloque->usado = AlinearArena(sizeof(BloqueArena));
+    bloque->mapeado = mapeado;
+    estadisticas->reservado += tamanio;
+    estadisticas->bloques++;
+    if (con_paginas_grandes) estadisticas->bloques_paginas_grandes++;
+    return bloque;
+}
+
+/**
+ * @fun: ArenaCrear(size_t tam_inicial, bool paginas_grandes).
+ * @param tam_inicial: bytes que se espera alocar; el primer bloque tiene
+ * lugar para ellos y la propia arena.
+ * @param paginas_grandes: si se intenta respaldar los bloques de al menos
+ * ARENA_TAM_PAGINA_GRANDE bytes con páginas grandes (MAP_HUGETLB, o si no hay
+ * páginas reservadas, páginas grandes transparentes).
+ * @return: una arena nueva; NULL si no hubo memoria.
+ */
+Arena *ArenaCrear(size_t tam_inicial, bool paginas_grandes) {
+    EstadisticasArena estadisticas = {0, 0, 0, 0};
+    size_t tam_cabeceras = AlinearArena(sizeof(BloqueArena)) +
+                           AlinearArena(sizeof(Arena));
+    BloqueArena *bloque = NuevoBloqueArena(tam_cabeceras +
+                                           AlinearArena(tam_inicial),
+                                           paginas_grandes, &estadisticas);
+    if (bloque == NULL) return NULL;
+    // La arena ocupa el comienzo de su primer bloque.
+    Arena *arena = (Arena *)((char *)bloque + bloque->usado);
+    bloque->usado = tam_cabeceras;
+    arena->actual = bloque;
+    arena->paginas_grandes = paginas_grandes;
+    arena->estadisticas = estadisticas;
+    arena->estadisticas.usado = tam_cabeceras;
+    return arena;
+}
+
+/**
+ * @fun: ArenaAlocar(Arena *arena, size_t tamanio).
+ * @param arena: una arena creada.
+ * @param tamanio: cantidad de bytes a alocar.
+ * @brief: entrega tamanio bytes sin inicializar, alineados a
+ * ARENA_ALINEACION. Si el bloque actual no alcanza se pide uno nuevo.
+ * @return: puntero a la memoria; NULL si no hubo memoria.
+ */
+void *ArenaAlocar(Arena *arena, size_t tamanio) {
+    tamanio = AlinearArena(tamanio);
+    BloqueArena *bloque = arena->actual;
+    if (bloque->tamanio - bloque->usado < tamanio) {
+        // El bloque nuevo es al menos tan grande como el anterior, para que
+        // la cantidad de bloques crezca como el logaritmo de lo alocado.
+        size_t tam_bloque = AlinearArena(sizeof(BloqueArena)) + tamanio;
+        if (tam_bloque < bloque->tamanio) tam_bloque = bloque->tamanio;
+        if (tam_bloque < ARENA_TAM_BLOQUE_MINIMO) {
+            tam_bloque = ARENA_TAM_BLOQUE_MINIMO;
+        }
+        BloqueArena *nuevo = NuevoBloqueArena(tam_bloque,
+                                              arena->paginas_grandes,
+                                              &arena->estadisticas);
+        if (nuevo == NULL) return NULL;
+        nuevo->anterior = bloque;
+        arena->actual = nuevo;
+        bloque = nuevo;
+    }
+    void *memoria = (char *)bloque + bloque->usado;
+    bloque->usado += tamanio;
+    arena->estadisticas.usado += tamanio;
+    return memoria;
+}
+
+/**
+ * @fun: ArenaAlocarCeros(Arena *arena, size_t cantidad, size_t tamanio).
+ * @param arena: una arena creada.
+ * @param cantidad: cantidad de elementos.
+ * @param tamanio: tamaño en bytes de cada elemento.
+ * @brief: como ArenaAlocar(), pero para cantidad elementos y con la memoria
+ * en cero, igual que calloc().
+ * @return: puntero a la memoria; NULL si no hubo memoria.
+ */
+void *ArenaAlocarCeros(Arena *arena, size_t cantidad, size_t tamanio) {
+    if (tamanio != 0 && cantidad > SIZE_MAX / tamanio) return NULL;
+    void *memoria = ArenaAlocar(arena, cantidad * tamanio);
+    if (memoria != NULL) memset(memoria, 0, cantidad * tamanio);
+    return memoria;
+}
+
+/**
+ * @fun: ArenaEstadisticas(const Arena *arena, EstadisticasArena *estadisticas).
+ * @param arena: una arena creada, o NULL.
+ * @param estadisticas: estructura donde copiar el uso de memoria; queda en
+ * cero si la arena es NULL.
+ */
+void ArenaEstadisticas(const Arena *arena, EstadisticasArena *estadisticas) {
+    if (arena == NULL) {
+        memset(estadisticas, 0, sizeof(EstadisticasArena));
+    } else {
+        *estadisticas = arena->estadisticas;
+    }
+}
+
+/**
+ * @fun: ArenaDestruir(Arena *arena).
+ * @param arena: una arena creada, o NULL.
+ * @brief: libera todos los bloques de la arena, y con ellos toda la memoria
+ * que entregó y la propia arena.
+ */
+void ArenaDestruir(Arena *arena) {
+    if (arena == NULL) return;
+    BloqueArena *bloque = arena->actual;
+    // La arena vive en el primer bloque, que es el último en liberarse.
+    while (bloque != NULL) {
+        BloqueArena *anterior = bloque->anterior;
+        if (bloque->mapeado) {
+            munmap(bloque, bloque->tamanio);
+        } else {
+            free(bloque);
+        }
+        bloque = anterior;
+    }
+}
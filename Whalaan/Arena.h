@@ -0,0 +1,124 @@
+/**
+ * @file: Arena.h
+ * @brief: fichero de un alocador por regiones: la memoria se entrega de
+ * bloques grandes y se libera toda junta al destruir la arena.
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "Rii.h"
+
+// Alineación en bytes de toda memoria entregada por una arena.
+#define ARENA_ALINEACION 16
+
+// Tamaño mínimo en bytes de un bloque nuevo de una arena.
+#define ARENA_TAM_BLOQUE_MINIMO (64 * 1024)
+
+// Tamaño de una página grande; los bloques de al menos este tamaño de una
+// arena con páginas grandes se redondean a un múltiplo de él.
+#define ARENA_TAM_PAGINA_GRANDE (2 * 1024 * 1024)
+
+// Estructura con el uso de memoria de una arena.
+typedef struct _EstadisticasArena_ {
+    // Bytes pedidos al sistema, cabeceras incluidas.
+    size_t reservado;
+    // Bytes entregados, incluyendo el relleno por alineación.
+    size_t usado;
+    // Cantidad de bloques de la arena.
+    u32 bloques;
+    // Cantidad de bloques respaldados con páginas grandes.
+    u32 bloques_paginas_grandes;
+} EstadisticasArena;
+
+// Cabecera al comienzo de cada bloque de una arena.
+typedef struct _BloqueArena_ {
+    // Bloque pedido antes que este; NULL si es el primero.
+    struct _BloqueArena_ *anterior;
+    // Tamaño en bytes del bloque, cabecera incluida.
+    size_t tamanio;
+    // Bytes ocupados del bloque, cabecera incluida.
+    size_t usado;
+    // Si el bloque se obtuvo con mmap; si no, con malloc.
+    bool mapeado;
+} BloqueArena;
+
+// Estructura de una arena. Vive dentro de su primer bloque.
+typedef struct _Arena_ {
+    // Bloque del que se entrega memoria.
+    BloqueArena *actual;
+    // Si se intenta respaldar los bloques grandes con páginas grandes.
+    bool paginas_grandes;
+    // Uso de memoria de la arena.
+    EstadisticasArena estadisticas;
+} Arena;
+
+/**
+ * @fun: AlinearArena(size_t tamanio).
+ * @param tamanio: una cantidad de bytes.
+ * @return: el menor múltiplo de ARENA_ALINEACION mayor o igual a tamanio.
+ */
+size_t AlinearArena(size_t tamanio);
+
+/**
+ * @fun: NuevoBloqueArena(size_t tamanio, bool paginas_grandes,
+ *                         EstadisticasArena *estadisticas).
+ * @param tamanio: tamaño en bytes del bloque, cabecera incluida.
+ * @param paginas_grandes: si se intenta respaldar el bloque con páginas
+ * grandes; sólo se hace si el bloque ocupa al menos una.
+ * @param estadisticas: estadísticas de la arena a actualizar.
+ * @brief: pide un bloque al sistema e inicializa su cabecera.
+ * @return: el bloque nuevo; NULL si no hubo memoria.
+ */
+BloqueArena *NuevoBloqueArena(size_t tamanio, bool paginas_grandes,
+                              EstadisticasArena *estadisticas);
+
+/**
+ * @fun: ArenaCrear(size_t tam_inicial, bool paginas_grandes).
+ * @param tam_inicial: bytes que se espera alocar; el primer bloque tiene
+ * lugar para ellos y la propia arena.
+ * @param paginas_grandes: si se intenta respaldar los bloques de al menos
+ * ARENA_TAM_PAGINA_GRANDE bytes con páginas grandes (MAP_HUGETLB, o si no hay
+ * páginas reservadas, páginas grandes transparentes).
+ * @return: una arena nueva; NULL si no hubo memoria.
+ */
+Arena *ArenaCrear(size_t tam_inicial, bool paginas_grandes);
+
+/**
+ * @fun: ArenaAlocar(Arena *arena, size_t tamanio).
+ * @param arena: una arena creada.
+ * @param tamanio: cantidad de bytes a alocar.
+ * @brief: entrega tamanio bytes sin inicializar, alineados a
+ * ARENA_ALINEACION. Si el bloque actual no alcanza se pide uno nuevo.
+ * @return: puntero a la memoria; NULL si no hubo memoria.
+ */
+void *ArenaAlocar(Arena *arena, size_t tamanio);
+
+/**
+ * @fun: ArenaAlocarCeros(Arena *arena, size_t cantidad, size_t tamanio).
+ * @param arena: una arena creada.
+ * @param cantidad: cantidad de elementos.
+ * @param tamanio: tamaño en bytes de cada elemento.
+ * @brief: como ArenaAlocar(), pero para cantidad elementos y con la memoria
+ * en cero, igual que calloc().
+ * @return: puntero a la memoria; NULL si no hubo memoria.
+ */
+void *ArenaAlocarCeros(Arena *arena, size_t cantidad, size_t tamanio);
+
+/**
+ * @fun: ArenaEstadisticas(const Arena *arena, EstadisticasArena *estadisticas).
+ * @param arena: una arena creada, o NULL.
+ * @param estadisticas: estructura donde copiar el uso de memoria; queda en
+ * cero si la arena es NULL.
+ */
+void ArenaEstadisticas(const Arena *arena, EstadisticasArena *estadisticas);
+
+/**
+ * @fun: ArenaDestruir(Arena *arena).
+ * @param arena: una arena creada, o NULL.
+ * @brief: libera todos los bloques de la arena, y con ellos toda la memoria
+ * que entregó y la propia arena.
+ */
+void ArenaDestruir(Arena *arena);
+
+#endif // ARENA_H
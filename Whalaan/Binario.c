@@ -0,0 +1,281 @@
+/**
+ * @file: Binario.c
+ * @brief: implementación de las funciones para guardar y cargar un grafo en
+ * formato binario.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Binario.h"
+#include "Construye.h"
+
+/**
+ * @fun: EscribirArreglo(FILE *archivo, const u32 *arreglo, size_t cantidad).
+ * @param archivo: archivo abierto para escritura.
+ * @param arreglo: arreglo a escribir.
+ * @param cantidad: cantidad de elementos del arreglo.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool EscribirArreglo(FILE *archivo, const u32 *arreglo, size_t cantidad) {
+    return fwrite(arreglo, sizeof(u32), cantidad, archivo) != cantidad;
+}
+
+/**
+ * @fun: GuardarGrafoBinario(Grafo G, const char *ruta, bool con_coloreo).
+ * @param G: un grafo correctamente construido.
+ * @param ruta: ruta del archivo a escribir.
+ * @param con_coloreo: si es true también se guarda el orden y el coloreo.
+ * @return: 0 si se guardó correctamente; 1 si hubo algún error.
+ */
+char GuardarGrafoBinario(Grafo G, const char *ruta, bool con_coloreo) {
+    if (G == NULL) return 1;
+    u32 numVertices = G->infoGrafo[Vertices];
+    // Arreglo auxiliar para escribir los comienzos de los vecinos si están
+    // comprimidos.
+    u32 *auxiliar = malloc((size_t)numVertices * sizeof(u32));
+    if (auxiliar == NULL) return 1;
+    FILE *archivo = fopen(ruta, "wb");
+    if (archivo == NULL) {
+        free(auxiliar);
+        return 1;
+    }
+    CabeceraBinario cabecera;
+    memset(&cabecera, 0, sizeof(CabeceraBinario));
+    memcpy(cabecera.magia, BINARIO_MAGIA, sizeof(cabecera.magia));
+    cabecera.version = BINARIO_VERSION;
+    cabecera.banderas = con_coloreo ? BINARIO_CON_COLOREO : 0;
+    memcpy(cabecera.infoGrafo, G->infoGrafo, sizeof(cabecera.infoGrafo));
+    bool error = fwrite(&cabecera, sizeof(CabeceraBinario), 1, archivo) != 1;
+
+    // Nombres, grados y comienzo de los vecinos de cada vértice.
+    for (u32 x = Nombre; x <= Grado && !error; x++) {
+        error = EscribirArreglo(archivo, G->infoVertices[x], numVertices);
+    }
+    // Los arreglos de vecinos del grafo ya tienen el formato del archivo.
+    if (!error && !EstaComprimido(G)) {
+        error = EscribirArreglo(archivo, G->inicio_vecinos,
+                                (size_t)numVertices + 1);
+        if (!error) {
+            error = EscribirArreglo(archivo, G->array_vecinos,
+                                    2 * (size_t)G->infoGrafo[Lados]);
+        }
+    } else if (!error) {
+        // Si están comprimidos, los comienzos son las sumas de los grados y
+        // los vecinos se escriben decodificados, vértice por vértice.
+        u32 inicio = 0;
+        for (u32 i = 0; i < numVertices; i++) {
+            auxiliar[i] = inicio;
+            inicio += G->infoVertices[Grado][i];
+        }
+        error = EscribirArreglo(archivo, auxiliar, numVertices) ||
+                EscribirArreglo(archivo, &inicio, 1);
+        for (u32 i = 0; i < numVertices && !error; i++) {
+            error = EscribirArreglo(archivo, VecinosEnCache(G, i),
+                                    G->infoVertices[Grado][i]);
+        }
+    }
+    if (con_coloreo && !error) {
+        error = EscribirArreglo(archivo, G->array_orden_vertices, numVertices);
+        if (!error) {
+            error = EscribirArreglo(archivo, G->infoVertices[Color],
+                                    numVertices);
+        }
+        if (!error) {
+            error = EscribirArreglo(archivo, G->array_cantidad_colores,
+                                    (size_t)G->infoGrafo[DeltaGrande] + 1);
+        }
+    }
+    free(auxiliar);
+    if (fclose(archivo) != 0) error = true;
+    return error ? 1 : 0;
+}
+
+/**
+ * @fun: ValidarGrafoBinario(const CabeceraBinario *cabecera).
+ * @param cabecera: la cabecera de un archivo mapeado cuyo tamaño ya coincide
+ * con el que indica la cabecera.
+ * @brief: recorre una vez los arreglos del archivo, en O(n + m), y verifica
+ * que los comienzos de los vecinos empiecen en 0 y avancen según los grados,
+ * que todo vecino sea un índice de vértice y que delta grande sea el mayor
+ * grado. Si está el coloreo, verifica también que el orden sea una
+ * permutación de los índices, que el número de colores sea a lo sumo delta
+ * grande más uno, que todo color sea menor que él y el último se use, que
+ * la cantidad de vértices de cada color coincida con la de los colores y que
+ * ningún lado tenga sus dos extremos del mismo color. Así las funciones que
+ * dimensionan sus arreglos con el número de colores no se salen de ellos.
+ * @return: 0 si el contenido es válido; 1 si no o si no hubo memoria.
+ */
+char ValidarGrafoBinario(const CabeceraBinario *cabecera) {
+    u32 n = cabecera->infoGrafo[Vertices];
+    u32 delta = cabecera->infoGrafo[DeltaGrande];
+    const u32 *grados = (const u32 *)(cabecera + 1) + n;
+    const u32 *inicio_vecinos = grados + n;
+    const u32 *vecinos = inicio_vecinos + n + 1;
+    if (inicio_vecinos[0] != 0) return 1;
+    u32 max_grado = 0;
+    for (u32 i = 0; i < n; i++) {
+        // Con los comienzos en orden y el último igual a 2m, ningún vecino
+        // queda fuera del arreglo.
+        if (inicio_vecinos[i + 1] < inicio_vecinos[i] ||
+            inicio_vecinos[i + 1] - inicio_vecinos[i] != grados[i]) {
+            return 1;
+        }
+        if (grados[i] > max_grado) max_grado = grados[i];
+    }
+    if (max_grado != delta) return 1;
+    for (size_t j = 0; j < inicio_vecinos[n]; j++) {
+        if (vecinos[j] >= n) return 1;
+    }
+    if (!(cabecera->banderas & BINARIO_CON_COLOREO)) return 0;
+    const u32 *orden = vecinos + inicio_vecinos[n];
+    const u32 *colores = orden + n;
+    const u32 *cantidad_colores = colores + n;
+    u32 num_colores = cabecera->infoGrafo[Colores];
+    if (num_colores == 0 || num_colores > delta + 1) return 1;
+    bool *visto = calloc(n, sizeof(bool));
+    u32 *cantidad = calloc((size_t)delta + 1, sizeof(u32));
+    char error = visto == NULL || cantidad == NULL;
+    for (u32 i = 0; i < n && !error; i++) {
+        error = colores[i] >= num_colores || orden[i] >= n ||
+                visto[orden[i]];
+        if (!error) {
+            visto[orden[i]] = true;
+            cantidad[colores[i]]++;
+        }
+    }
+    // Los colores ya son menores que num_colores, así que se pueden comparar
+    // las cantidades de todos los colores hasta delta grande.
+    if (!error) {
+        error = cantidad[num_colores - 1] == 0 ||
+                memcmp(cantidad, cantidad_colores,
+                       ((size_t)delta + 1) * sizeof(u32)) != 0;
+    }
+    for (u32 i = 0; i < n && !error; i++) {
+        for (u32 j = inicio_vecinos[i]; j < inicio_vecinos[i + 1]; j++) {
+            if (colores[vecinos[j]] == colores[i]) {
+                error = 1;
+                break;
+            }
+        }
+    }
+    free(visto);
+    free(cantidad);
+    return error;
+}
+
+/**
+ * @fun: CargarGrafoBinario(const char *ruta).
+ * @param ruta: ruta de un archivo escrito con GuardarGrafoBinario().
+ * @brief: mapea el archivo en memoria (copia privada) y arma el grafo sobre
+ * las páginas mapeadas: los nombres, los grados, los vecinos, el orden, los
+ * colores y la cantidad de colores se usan en su lugar sin copiarlos. Antes
+ * se verifica el contenido con ValidarGrafoBinario(). Si el archivo no tiene
+ * coloreo se le da el orden natural de los índices y se corre Greedy, como
+ * al construirlo.
+ * @return: el grafo cargado; NULL si hubo errores o el archivo no es válido.
+ */
+Grafo CargarGrafoBinario(const char *ruta) {
+    int fd = open(ruta, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat info;
+    if (fstat(fd, &info) != 0 ||
+        (size_t)info.st_size < sizeof(CabeceraBinario)) {
+        close(fd);
+        return NULL;
+    }
+    size_t tamanio = (size_t)info.st_size;
+    // Mapeo privado y escribible: las páginas que el grafo modifique (orden
+    // y cantidad de colores) se copian y el archivo nunca se altera.
+    void *mapeo = mmap(NULL, tamanio, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                       fd, 0);
+    close(fd);
+    if (mapeo == MAP_FAILED) return NULL;
+
+    // Verificamos la cabecera y que el tamaño del archivo sea el esperado.
+    CabeceraBinario *cabecera = mapeo;
+    u32 n = cabecera->infoGrafo[Vertices];
+    size_t dos_m = 2 * (size_t)cabecera->infoGrafo[Lados];
+    bool con_coloreo = cabecera->banderas & BINARIO_CON_COLOREO;
+    size_t esperado = 3 * (size_t)n + 1 + dos_m;
+    if (con_coloreo) {
+        esperado += 2 * (size_t)n + cabecera->infoGrafo[DeltaGrande] + 1;
+    }
+    esperado = sizeof(CabeceraBinario) + esperado * sizeof(u32);
+    if (memcmp(cabecera->magia, BINARIO_MAGIA, sizeof(cabecera->magia)) != 0
+        || cabecera->version != BINARIO_VERSION || n == 0
+        || tamanio != esperado) {
+        munmap(mapeo, tamanio);
+        return NULL;
+    }
+    u32 *nombres = (u32 *)(cabecera + 1);
+    u32 *grados = nombres + n;
+    u32 *inicio_vecinos = grados + n;
+    u32 *vecinos = inicio_vecinos + n + 1;
+    if (inicio_vecinos[n] != dos_m || ValidarGrafoBinario(cabecera)) {
+        munmap(mapeo, tamanio);
+        return NULL;
+    }
+
+    // La arena del grafo tiene lugar para la estructura y, si el archivo no
+    // trae el coloreo, para sus colores, su orden y su cantidad de colores.
+    Arena *arena = ArenaCrear(TamanioArenaGrafo(n,
+                                  cabecera->infoGrafo[DeltaGrande]), false);
+    if (arena == NULL) {
+        munmap(mapeo, tamanio);
+        return NULL;
+    }
+    Grafo G = ArenaAlocarCeros(arena, 1, sizeof(GrafoSt));
+    if (G == NULL) {
+        ArenaDestruir(arena);
+        munmap(mapeo, tamanio);
+        return NULL;
+    }
+    G->arena = arena;
+    memcpy(G->infoGrafo, cabecera->infoGrafo, sizeof(G->infoGrafo));
+    // Los arreglos de vecinos se usan directamente desde el archivo mapeado,
+    // que queda a cargo de la topología del grafo.
+    if (CrearTopologia(G, 0, false)) {
+        munmap(mapeo, tamanio);
+        goto ERROR;
+    }
+    G->topologia->mapeo = mapeo;
+    G->topologia->tam_mapeo = tamanio;
+    G->array_vecinos = vecinos;
+    G->inicio_vecinos = inicio_vecinos;
+    // Los nombres y los grados, que no cambian, también se usan en su lugar.
+    G->infoVertices[Nombre] = nombres;
+    G->infoVertices[Grado] = grados;
+    if (con_coloreo) {
+        u32 *colores = vecinos + dos_m + n;
+        G->array_orden_vertices = vecinos + dos_m;
+        G->infoVertices[Color] = colores;
+        G->array_cantidad_colores = colores + n;
+    } else {
+        G->array_orden_vertices = ArenaAlocar(arena, n * sizeof(u32));
+        G->infoVertices[Color] = ArenaAlocarCeros(arena, n, sizeof(u32));
+        if (G->array_orden_vertices == NULL ||
+            G->infoVertices[Color] == NULL || InicializarGrafo(G)) {
+            goto ERROR;
+        }
+    }
+    return G;
+
+    ERROR:
+        DestruccionDelGrafo(G);
+        return NULL;
+}
+
+/**
+ * @fun: DesmapearTopologia(TopologiaSt *topologia).
+ * @param topologia: una topología sin grafos que la usen.
+ * @brief: libera el archivo mapeado de la topología, si lo tiene.
+ */
+void DesmapearTopologia(TopologiaSt *topologia) {
+    if (topologia->mapeo != NULL) {
+        munmap(topologia->mapeo, topologia->tam_mapeo);
+        topologia->mapeo = NULL;
+        topologia->tam_mapeo = 0;
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * @file: Binario.h
+ * @brief: fichero de las funciones para guardar un grafo en un archivo
+ * binario y cargarlo luego mapeándolo en memoria, sin volver a leer el
+ * formato DIMACS ni reconstruir la tabla hash.
+ */
+
+#ifndef BINARIO_H
+#define BINARIO_H
+
+#include "Rii.h"
+
+// Identificador al comienzo de todo archivo binario de grafo.
+#define BINARIO_MAGIA "DISC2GRF"
+
+// Versión del formato. Se guarda en el orden de bytes de la máquina, por lo
+// que un archivo escrito con otro orden de bytes no coincide y se rechaza.
+#define BINARIO_VERSION 1u
+
+// Bandera que indica que el archivo guarda el orden y el coloreo del grafo.
+#define BINARIO_CON_COLOREO 1u
+
+/*
+ Cabecera del archivo binario. A continuación se guardan, como arreglos de
+ u32 y en este orden:
+    nombres[n], grados[n], inicio_vecinos[n+1], vecinos[2m],
+ y si está la bandera BINARIO_CON_COLOREO:
+    orden[n], colores[n], cantidad_colores[DeltaGrande+1].
+ Los vecinos del vértice i son vecinos[inicio_vecinos[i]..inicio_vecinos[i+1]).
+ */
+typedef struct _CabeceraBinario_ {
+    char magia[8];
+    u32 version;
+    u32 banderas;
+    // Número de vértices, lados, colores y delta grande del grafo.
+    u32 infoGrafo[4];
+} CabeceraBinario;
+
+/**
+ * @fun: GuardarGrafoBinario(Grafo G, const char *ruta, bool con_coloreo).
+ * @param G: un grafo correctamente construido.
+ * @param ruta: ruta del archivo a escribir.
+ * @param con_coloreo: si es true también se guarda el orden y el coloreo.
+ * @return: 0 si se guardó correctamente; 1 si hubo algún error.
+ */
+char GuardarGrafoBinario(Grafo G, const char *ruta, bool con_coloreo);
+
+/**
+ * @fun: ValidarGrafoBinario(const CabeceraBinario *cabecera).
+ * @param cabecera: la cabecera de un archivo mapeado cuyo tamaño ya coincide
+ * con el que indica la cabecera.
+ * @brief: recorre una vez los arreglos del archivo, en O(n + m), y verifica
+ * que los comienzos de los vecinos empiecen en 0 y avancen según los grados,
+ * que todo vecino sea un índice de vértice y que delta grande sea el mayor
+ * grado. Si está el coloreo, verifica también que el orden sea una
+ * permutación de los índices, que el número de colores sea a lo sumo delta
+ * grande más uno, que todo color sea menor que él y el último se use, que
+ * la cantidad de vértices de cada color coincida con la de los colores y que
+ * ningún lado tenga sus dos extremos del mismo color. Así las funciones que
+ * dimensionan sus arreglos con el número de colores no se salen de ellos.
+ * @return: 0 si el contenido es válido; 1 si no o si no hubo memoria.
+ */
+char ValidarGrafoBinario(const CabeceraBinario *cabecera);
+
+/**
+ * @fun: CargarGrafoBinario(const char *ruta).
+ * @param ruta: ruta de un archivo escrito con GuardarGrafoBinario().
+ * @brief: mapea el archivo en memoria (copia privada) y arma el grafo sobre
+ * las páginas mapeadas: los nombres, los grados, los vecinos, el orden, los
+ * colores y la cantidad de colores se usan en su lugar sin copiarlos. Antes
+ * se verifica el contenido con ValidarGrafoBinario(). Si el archivo no tiene
+ * coloreo se le da el orden natural de los índices y se corre Greedy, como
+ * al construirlo.
+ * @return: el grafo cargado; NULL si hubo errores o el archivo no es válido.
+ */
+Grafo CargarGrafoBinario(const char *ruta);
+
+/**
+ * @fun: DesmapearTopologia(TopologiaSt *topologia).
+ * @param topologia: una topología sin grafos que la usen.
+ * @brief: libera el archivo mapeado de la topología, si lo tiene.
+ */
+void DesmapearTopologia(TopologiaSt *topologia);
+
+#endif // BINARIO_H
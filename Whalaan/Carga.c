@@ -1,10 +1,14 @@
 /**
  * @file: Carga.c
  * @brief: Implementación de funciones necesarias para cargar los datos del
- *        grafo desde standard input.
+ *        grafo desde standard input o desde un archivo mapeado en memoria.
  */
 
-#include "Rii.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "Carga.h"
 
 /**
  * @fun: VerticesIguales(u32 vertice_1, u32 vertice_2)
@@ -17,6 +21,22 @@ bool VerticesIguales(u32 vertice_1, u32 vertice_2) {
     return vertice_1 == vertice_2;
 }
 
+/**
+ * @fun: ActualizarRango(u32 *minimo, u32 *maximo, u32 vertice_1,
+ *                       u32 vertice_2).
+ * @param minimo: menor nombre visto hasta el momento.
+ * @param maximo: mayor nombre visto hasta el momento.
+ * @param vertice_1: nombre de un extremo de un lado.
+ * @param vertice_2: nombre del otro extremo.
+ * @brief: actualiza el rango de nombres con los extremos de un lado.
+ */
+void ActualizarRango(u32 *minimo, u32 *maximo, u32 vertice_1, u32 vertice_2) {
+    u32 menor = vertice_1 < vertice_2 ? vertice_1 : vertice_2;
+    u32 mayor = vertice_1 < vertice_2 ? vertice_2 : vertice_1;
+    if (menor < *minimo) *minimo = menor;
+    if (mayor > *maximo) *maximo = mayor;
+}
+
 /**
  * @fun: datos_t CargaDatos()
  * @brief: toma los datos ingresados por standard input, reconociendo el formato
@@ -115,6 +135,9 @@ datos_t CargaDatos() {
             return NULL;
         } 
     }
+    // Inicializamos el rango de nombres vacío.
+    carga->nombre_minimo = UINT_MAX;
+    carga->nombre_maximo = 0;
     // Ahora que conocemos la cantidad de lados alojamos memoria en el arreglo
     // de la estructura para ir leyendo los lados.
     carga->arreglo_lados = calloc(carga->cant_lados * 2, sizeof(u32));
@@ -184,7 +207,10 @@ datos_t CargaDatos() {
             return NULL;
         }
         // Al llegar aquí se hizo una lectura de un lado, por lo que
-        // continuamos con los próximos dos...
+        // actualizamos el rango de nombres y continuamos con los próximos
+        // dos...
+        ActualizarRango(&carga->nombre_minimo, &carga->nombre_maximo,
+                        vertice_1, vertice_2);
         j=j+2;
     }
     // Devolvemos la estructura con los datos cargados...
@@ -201,3 +227,359 @@ void DestruccionCargaDatos(datos_t datos){
         free(datos);
     }
 }
+
+/**
+ * @fun: MapearArchivo(const char *ruta, ArchivoMapeado *archivo).
+ * @param ruta: ruta del archivo a mapear.
+ * @param archivo: estructura donde se guarda el mapeo.
+ * @brief: abre el archivo indicado y lo mapea en memoria en modo solo
+ * lectura, avisando al kernel que será recorrido secuencialmente.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool MapearArchivo(const char *ruta, ArchivoMapeado *archivo) {
+    int fd = open(ruta, O_RDONLY);
+    if (fd < 0) return true;
+    struct stat info;
+    // Un archivo vacío no puede mapearse y tampoco tiene un grafo.
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return true;
+    }
+    void *mapeo = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE,
+                       fd, 0);
+    // El mapeo se mantiene aunque cerremos el descriptor.
+    close(fd);
+    if (mapeo == MAP_FAILED) return true;
+    madvise(mapeo, (size_t)info.st_size, MADV_SEQUENTIAL);
+    archivo->inicio = mapeo;
+    archivo->tamanio = (size_t)info.st_size;
+    archivo->fin = archivo->inicio + archivo->tamanio;
+    return false;
+}
+
+/**
+ * @fun: DesmapearArchivo(ArchivoMapeado *archivo).
+ * @param archivo: un archivo mapeado con MapearArchivo().
+ * @brief: libera el mapeo del archivo.
+ */
+void DesmapearArchivo(ArchivoMapeado *archivo) {
+    if (archivo->inicio != NULL) {
+        munmap((void *)archivo->inicio, archivo->tamanio);
+        archivo->inicio = archivo->fin = NULL;
+        archivo->tamanio = 0;
+    }
+}
+
+/**
+ * @fun: LeerU32(const char *cursor, const char *fin, u32 *valor).
+ * @param cursor: posición desde donde leer.
+ * @param fin: límite de lectura.
+ * @param valor: lugar donde se guarda el número leído.
+ * @brief: lee un número decimal sin signo a partir de cursor.
+ * @return: la posición siguiente al último dígito leído; NULL si no había
+ * ningún dígito o si el número no entra en un u32.
+ */
+const char *LeerU32(const char *cursor, const char *fin, u32 *valor) {
+    const char *inicio = cursor;
+    // Acumulamos en 64 bits para detectar desbordes sin divisiones.
+    unsigned long long numero = 0;
+    while (cursor < fin && (unsigned)(*cursor - '0') < 10) {
+        numero = numero * 10 + (unsigned)(*cursor - '0');
+        if (numero > UINT_MAX) return NULL;
+        cursor++;
+    }
+    if (cursor == inicio) return NULL;
+    *valor = (u32)numero;
+    return cursor;
+}
+
+/**
+ * @fun: SaltarEspacios(const char *cursor, const char *fin).
+ * @param cursor: posición desde donde avanzar.
+ * @param fin: límite de lectura.
+ * @return: la primera posición desde cursor que no es un espacio o tabulador.
+ */
+const char *SaltarEspacios(const char *cursor, const char *fin) {
+    while (cursor < fin && (*cursor == ' ' || *cursor == '\t')) cursor++;
+    return cursor;
+}
+
+/**
+ * @fun: SiguienteLinea(const char *cursor, const char *fin).
+ * @param cursor: una posición dentro de una línea.
+ * @param fin: límite de lectura.
+ * @return: la posición del primer caracter de la línea siguiente, o fin si
+ * no hay más líneas.
+ */
+const char *SiguienteLinea(const char *cursor, const char *fin) {
+    const char *salto = memchr(cursor, '\n', (size_t)(fin - cursor));
+    return salto == NULL ? fin : salto + 1;
+}
+
+/**
+ * @fun: FinDeLinea(const char *cursor, const char *fin).
+ * @param cursor: posición a verificar.
+ * @param fin: límite de lectura.
+ * @return: true si en cursor termina la línea (salto de línea, retorno de
+ * carro o final del archivo); false en caso contrario.
+ */
+bool FinDeLinea(const char *cursor, const char *fin) {
+    return cursor == fin || *cursor == '\n' || *cursor == '\r';
+}
+
+/**
+ * @fun: LeerEncabezado(const char *cursor, const char *fin, datos_t carga).
+ * @param cursor: inicio del archivo.
+ * @param fin: límite de lectura.
+ * @param carga: estructura donde guardar la cantidad de vértices y lados.
+ * @brief: saltea los comentarios y lee la línea "p edge n m".
+ * @return: la posición de la primera línea de lados; NULL si la línea no
+ * tiene el formato esperado.
+ */
+const char *LeerEncabezado(const char *cursor, const char *fin, datos_t carga) {
+    // Salteamos las líneas de comentarios.
+    while (cursor < fin && *cursor == 'c') {
+        cursor = SiguienteLinea(cursor, fin);
+    }
+    // Si no quedan líneas no hay grafo, igual que cuando fgets() falla.
+    if (cursor == fin) return NULL;
+    if ((size_t)(fin - cursor) < 7 || strncmp(cursor, "p edge ", 7) != 0) {
+        printf("Error en la primera linea sin comentario\n");
+        return NULL;
+    }
+    cursor = SaltarEspacios(cursor + 7, fin);
+    cursor = LeerU32(cursor, fin, &carga->cant_vertices);
+    if (cursor == NULL || carga->cant_vertices == 0 ||
+        (*cursor != ' ' && *cursor != '\t')) {
+        printf("Error en primera linea sin comentario\n");
+        return NULL;
+    }
+    cursor = SaltarEspacios(cursor, fin);
+    cursor = LeerU32(cursor, fin, &carga->cant_lados);
+    if (cursor == NULL || carga->cant_lados == 0 || !FinDeLinea(cursor, fin)) {
+        printf("Error en primer linea sin comentario\n");
+        return NULL;
+    }
+    return SiguienteLinea(cursor, fin);
+}
+
+/**
+ * @fun: LeerLado(const char *cursor, const char *fin, u32 *vertice_1,
+ *                u32 *vertice_2).
+ * @param cursor: inicio de una línea de lado.
+ * @param fin: límite de lectura.
+ * @param vertice_1: lugar donde guardar el primer extremo.
+ * @param vertice_2: lugar donde guardar el segundo extremo.
+ * @brief: lee una línea "e v w", verificando que los extremos sean distintos.
+ * @return: la posición de la línea siguiente; NULL si la línea es inválida.
+ */
+const char *LeerLado(const char *cursor, const char *fin, u32 *vertice_1,
+                     u32 *vertice_2) {
+    if ((fin - cursor) < 2 || cursor[0] != 'e' || cursor[1] != ' ') {
+        return NULL;
+    }
+    cursor = LeerU32(SaltarEspacios(cursor + 2, fin), fin, vertice_1);
+    if (cursor == NULL || cursor == fin || (*cursor != ' ' && *cursor != '\t'))
+        return NULL;
+    cursor = LeerU32(SaltarEspacios(cursor, fin), fin, vertice_2);
+    if (cursor == NULL || !FinDeLinea(cursor, fin)) return NULL;
+    // Un lado no puede unir un vértice consigo mismo.
+    if (VerticesIguales(*vertice_1, *vertice_2)) return NULL;
+    return SiguienteLinea(cursor, fin);
+}
+
+/**
+ * @fun: CargaDatosArchivo(const char *ruta).
+ * @param ruta: ruta de un archivo en formato DIMACS.
+ * @brief: igual que CargaDatos() pero leyendo el archivo mapeado en memoria
+ * en una sola pasada, sin copiar líneas a un buffer intermedio.
+ * @return: la estructura con los datos cargados; NULL si hubo errores.
+ */
+datos_t CargaDatosArchivo(const char *ruta) {
+    ArchivoMapeado archivo;
+    if (MapearArchivo(ruta, &archivo)) {
+        printf("No se pudo abrir el archivo %s\n", ruta);
+        return NULL;
+    }
+    datos_t carga = calloc(1, sizeof(struct _datos_t));
+    if (carga == NULL) {
+        DesmapearArchivo(&archivo);
+        return NULL;
+    }
+    const char *cursor = LeerEncabezado(archivo.inicio, archivo.fin, carga);
+    if (cursor == NULL) goto ERROR;
+    carga->arreglo_lados = calloc((size_t)carga->cant_lados * 2, sizeof(u32));
+    if (carga->arreglo_lados == NULL) goto ERROR;
+    u32 *lados = carga->arreglo_lados;
+    carga->nombre_minimo = UINT_MAX;
+    carga->nombre_maximo = 0;
+    for (u32 i = 0; i < carga->cant_lados; i++) {
+        // Como en CargaDatos(), los lados faltantes o mal formados son error.
+        if (cursor < archivo.fin) {
+            cursor = LeerLado(cursor, archivo.fin, &lados[2*i],
+                              &lados[2*i + 1]);
+        } else {
+            cursor = NULL;
+        }
+        if (cursor == NULL) {
+            printf("Error de lectura en el lado %u\n", i+1);
+            goto ERROR;
+        }
+        ActualizarRango(&carga->nombre_minimo, &carga->nombre_maximo,
+                        lados[2*i], lados[2*i + 1]);
+    }
+    DesmapearArchivo(&archivo);
+    return carga;
+
+    ERROR:
+        DesmapearArchivo(&archivo);
+        DestruccionCargaDatos(carga);
+        return NULL;
+}
+
+/**
+ * @fun: ContarLineasTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoCarga.
+ * @brief: primera pasada de la carga paralela; cuenta las líneas del trozo.
+ * @return: NULL.
+ */
+void *ContarLineasTrozo(void *trozo) {
+    TrozoCarga *t = trozo;
+    u32 lineas = 0;
+    const char *cursor = t->inicio;
+    while (cursor < t->fin) {
+        cursor = SiguienteLinea(cursor, t->fin);
+        lineas++;
+    }
+    t->cant_lineas = lineas;
+    return NULL;
+}
+
+/**
+ * @fun: LeerLadosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoCarga con primer_lado ya
+ * calculado.
+ * @brief: segunda pasada de la carga paralela; lee los lados del trozo y
+ * los escribe en su posición final del arreglo de lados, de forma que el
+ * orden de los lados es el mismo que en la carga secuencial.
+ * @return: NULL.
+ */
+void *LeerLadosTrozo(void *trozo) {
+    TrozoCarga *t = trozo;
+    const char *cursor = t->inicio;
+    u32 *lado;
+    t->lado_con_error = UINT_MAX;
+    t->nombre_minimo = UINT_MAX;
+    t->nombre_maximo = 0;
+    // Las líneas posteriores al último lado declarado se ignoran, igual que
+    // en la carga secuencial.
+    for (u32 i = t->primer_lado; i < t->cant_lados && cursor < t->fin; i++) {
+        lado = &t->arreglo_lados[2*(size_t)i];
+        cursor = LeerLado(cursor, t->fin, &lado[0], &lado[1]);
+        if (cursor == NULL) {
+            t->lado_con_error = i;
+            break;
+        }
+        ActualizarRango(&t->nombre_minimo, &t->nombre_maximo, lado[0],
+                        lado[1]);
+    }
+    return NULL;
+}
+
+/**
+ * @fun: CargaDatosArchivoParalelo(const char *ruta, u32 num_hilos).
+ * @param ruta: ruta de un archivo en formato DIMACS.
+ * @param num_hilos: cantidad de hilos a usar; 0 usa todos los procesadores.
+ * @brief: como CargaDatosArchivo(), pero divide los lados del archivo en
+ * trozos que terminan en fin de línea y los lee en paralelo. Los lados quedan
+ * en el mismo orden que en la carga secuencial y los errores se reportan
+ * para el mismo lado.
+ * @return: la estructura con los datos cargados; NULL si hubo errores.
+ */
+datos_t CargaDatosArchivoParalelo(const char *ruta, u32 num_hilos) {
+    ArchivoMapeado archivo;
+    if (MapearArchivo(ruta, &archivo)) {
+        printf("No se pudo abrir el archivo %s\n", ruta);
+        return NULL;
+    }
+    datos_t carga = calloc(1, sizeof(struct _datos_t));
+    TrozoCarga *trozos = NULL;
+    if (carga == NULL) goto ERROR;
+    const char *cuerpo = LeerEncabezado(archivo.inicio, archivo.fin, carga);
+    if (cuerpo == NULL) goto ERROR;
+    carga->arreglo_lados = calloc((size_t)carga->cant_lados * 2, sizeof(u32));
+    if (carga->arreglo_lados == NULL) goto ERROR;
+
+    // Elegimos la cantidad de hilos, sin hacer trozos demasiado chicos.
+    if (num_hilos == 0) num_hilos = CantidadDeProcesadores();
+    size_t tam_cuerpo = (size_t)(archivo.fin - cuerpo);
+    if (tam_cuerpo / TAM_MINIMO_TROZO < num_hilos) {
+        num_hilos = (u32)(tam_cuerpo / TAM_MINIMO_TROZO);
+    }
+    if (num_hilos == 0) num_hilos = 1;
+    trozos = calloc(num_hilos, sizeof(TrozoCarga));
+    if (trozos == NULL) goto ERROR;
+
+    // Partimos el cuerpo en trozos de igual tamaño y movemos cada corte al
+    // comienzo de la línea siguiente.
+    const char *corte = cuerpo;
+    for (u32 k = 0; k < num_hilos; k++) {
+        trozos[k].inicio = corte;
+        if (k + 1 == num_hilos) {
+            corte = archivo.fin;
+        } else {
+            const char *medio = cuerpo + tam_cuerpo / num_hilos * (k + 1);
+            if (medio < corte) medio = corte;
+            if (medio > cuerpo && medio[-1] != '\n') {
+                medio = SiguienteLinea(medio, archivo.fin);
+            }
+            corte = medio;
+        }
+        trozos[k].fin = corte;
+        trozos[k].cant_lados = carga->cant_lados;
+        trozos[k].arreglo_lados = carga->arreglo_lados;
+    }
+
+    // Primera pasada: contamos las líneas de cada trozo y con una suma de
+    // prefijos obtenemos dónde empiezan sus lados en el arreglo final.
+    EjecutarEnHilos(ContarLineasTrozo, trozos, sizeof(TrozoCarga), num_hilos);
+    u32 lineas = 0;
+    for (u32 k = 0; k < num_hilos; k++) {
+        trozos[k].primer_lado = lineas;
+        lineas = (trozos[k].cant_lineas > UINT_MAX - lineas) ?
+                 UINT_MAX : lineas + trozos[k].cant_lineas;
+    }
+
+    // Segunda pasada: cada hilo lee sus lados directamente a su lugar.
+    EjecutarEnHilos(LeerLadosTrozo, trozos, sizeof(TrozoCarga), num_hilos);
+    // El error a reportar es el primero del archivo, como en la carga
+    // secuencial; si no hubo ninguno pero faltan líneas, falta un lado.
+    u32 lado_con_error = lineas < carga->cant_lados ? lineas : UINT_MAX;
+    carga->nombre_minimo = UINT_MAX;
+    carga->nombre_maximo = 0;
+    for (u32 k = 0; k < num_hilos; k++) {
+        if (trozos[k].lado_con_error < lado_con_error) {
+            lado_con_error = trozos[k].lado_con_error;
+        }
+        // Un trozo sin lados tiene el rango vacío y no cambia nada.
+        if (trozos[k].nombre_minimo < carga->nombre_minimo) {
+            carga->nombre_minimo = trozos[k].nombre_minimo;
+        }
+        if (trozos[k].nombre_maximo > carga->nombre_maximo) {
+            carga->nombre_maximo = trozos[k].nombre_maximo;
+        }
+    }
+    if (lado_con_error != UINT_MAX) {
+        printf("Error de lectura en el lado %u\n", lado_con_error + 1);
+        goto ERROR;
+    }
+    free(trozos);
+    DesmapearArchivo(&archivo);
+    return carga;
+
+    ERROR:
+        free(trozos);
+        DesmapearArchivo(&archivo);
+        DestruccionCargaDatos(carga);
+        return NULL;
+}
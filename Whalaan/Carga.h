@@ -0,0 +1,176 @@
+/**
+ * @file: Carga.h
+ * @brief: fichero de las funciones auxiliares usadas en Carga.c para leer el
+ * formato DIMACS desde un archivo mapeado en memoria.
+ */
+
+#ifndef CARGA_H
+#define CARGA_H
+
+#include "Hilos.h"
+#include "Rii.h"
+
+// Estructura que representa un archivo de entrada mapeado en memoria.
+typedef struct _ArchivoMapeado_ {
+    // Puntero al primer caracter del archivo.
+    const char *inicio;
+    // Puntero a la posición siguiente al último caracter del archivo.
+    const char *fin;
+    // Tamaño en bytes del archivo mapeado.
+    size_t tamanio;
+} ArchivoMapeado;
+
+// Tamaño mínimo en bytes de cada trozo en la carga paralela; por debajo de
+// este tamaño no conviene lanzar más hilos.
+#define TAM_MINIMO_TROZO (1u << 20)
+
+// Estructura con el trabajo de cada hilo en la carga paralela.
+typedef struct _TrozoCarga_ {
+    // Límites del trozo; ambos caen en un comienzo de línea.
+    const char *inicio;
+    const char *fin;
+    // Cantidad de líneas del trozo, contadas en la primera pasada.
+    u32 cant_lineas;
+    // Número global del primer lado del trozo.
+    u32 primer_lado;
+    // Cantidad de lados declarada en el encabezado.
+    u32 cant_lados;
+    // Arreglo de lados de la carga donde escribir.
+    u32 *arreglo_lados;
+    // Número global del primer lado inválido del trozo; UINT_MAX si no hay.
+    u32 lado_con_error;
+    // Menor y mayor nombre de vértice leídos en el trozo.
+    u32 nombre_minimo;
+    u32 nombre_maximo;
+} TrozoCarga;
+
+/**
+ * @fun: ActualizarRango(u32 *minimo, u32 *maximo, u32 vertice_1,
+ *                       u32 vertice_2).
+ * @param minimo: menor nombre visto hasta el momento.
+ * @param maximo: mayor nombre visto hasta el momento.
+ * @param vertice_1: nombre de un extremo de un lado.
+ * @param vertice_2: nombre del otro extremo.
+ * @brief: actualiza el rango de nombres con los extremos de un lado.
+ */
+void ActualizarRango(u32 *minimo, u32 *maximo, u32 vertice_1, u32 vertice_2);
+
+/**
+ * @fun: MapearArchivo(const char *ruta, ArchivoMapeado *archivo).
+ * @param ruta: ruta del archivo a mapear.
+ * @param archivo: estructura donde se guarda el mapeo.
+ * @brief: abre el archivo indicado y lo mapea en memoria en modo solo
+ * lectura, avisando al kernel que será recorrido secuencialmente.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool MapearArchivo(const char *ruta, ArchivoMapeado *archivo);
+
+/**
+ * @fun: DesmapearArchivo(ArchivoMapeado *archivo).
+ * @param archivo: un archivo mapeado con MapearArchivo().
+ * @brief: libera el mapeo del archivo.
+ */
+void DesmapearArchivo(ArchivoMapeado *archivo);
+
+/**
+ * @fun: LeerU32(const char *cursor, const char *fin, u32 *valor).
+ * @param cursor: posición desde donde leer.
+ * @param fin: límite de lectura.
+ * @param valor: lugar donde se guarda el número leído.
+ * @brief: lee un número decimal sin signo a partir de cursor.
+ * @return: la posición siguiente al último dígito leído; NULL si no había
+ * ningún dígito o si el número no entra en un u32.
+ */
+const char *LeerU32(const char *cursor, const char *fin, u32 *valor);
+
+/**
+ * @fun: SaltarEspacios(const char *cursor, const char *fin).
+ * @param cursor: posición desde donde avanzar.
+ * @param fin: límite de lectura.
+ * @return: la primera posición desde cursor que no es un espacio o tabulador.
+ */
+const char *SaltarEspacios(const char *cursor, const char *fin);
+
+/**
+ * @fun: SiguienteLinea(const char *cursor, const char *fin).
+ * @param cursor: una posición dentro de una línea.
+ * @param fin: límite de lectura.
+ * @return: la posición del primer caracter de la línea siguiente, o fin si
+ * no hay más líneas.
+ */
+const char *SiguienteLinea(const char *cursor, const char *fin);
+
+/**
+ * @fun: FinDeLinea(const char *cursor, const char *fin).
+ * @param cursor: posición a verificar.
+ * @param fin: límite de lectura.
+ * @return: true si en cursor termina la línea (salto de línea, retorno de
+ * carro o final del archivo); false en caso contrario.
+ */
+bool FinDeLinea(const char *cursor, const char *fin);
+
+/**
+ * @fun: LeerEncabezado(const char *cursor, const char *fin, datos_t carga).
+ * @param cursor: inicio del archivo.
+ * @param fin: límite de lectura.
+ * @param carga: estructura donde guardar la cantidad de vértices y lados.
+ * @brief: saltea los comentarios y lee la línea "p edge n m".
+ * @return: la posición de la primera línea de lados; NULL si la línea no
+ * tiene el formato esperado.
+ */
+const char *LeerEncabezado(const char *cursor, const char *fin, datos_t carga);
+
+/**
+ * @fun: LeerLado(const char *cursor, const char *fin, u32 *vertice_1,
+ *                u32 *vertice_2).
+ * @param cursor: inicio de una línea de lado.
+ * @param fin: límite de lectura.
+ * @param vertice_1: lugar donde guardar el primer extremo.
+ * @param vertice_2: lugar donde guardar el segundo extremo.
+ * @brief: lee una línea "e v w", verificando que los extremos sean distintos.
+ * @return: la posición de la línea siguiente; NULL si la línea es inválida.
+ */
+const char *LeerLado(const char *cursor, const char *fin, u32 *vertice_1,
+                     u32 *vertice_2);
+
+/**
+ * @fun: CargaDatosArchivo(const char *ruta).
+ * @param ruta: ruta de un archivo en formato DIMACS.
+ * @brief: igual que CargaDatos() pero leyendo el archivo mapeado en memoria
+ * en una sola pasada, sin copiar líneas a un buffer intermedio.
+ * @return: la estructura con los datos cargados; NULL si hubo errores.
+ */
+datos_t CargaDatosArchivo(const char *ruta);
+
+/**
+ * @fun: ContarLineasTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoCarga.
+ * @brief: primera pasada de la carga paralela; cuenta las líneas del trozo.
+ * @return: NULL.
+ */
+void *ContarLineasTrozo(void *trozo);
+
+/**
+ * @fun: LeerLadosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoCarga con primer_lado ya
+ * calculado.
+ * @brief: segunda pasada de la carga paralela; lee los lados del trozo y
+ * los escribe en su posición final del arreglo de lados, de forma que el
+ * orden de los lados es el mismo que en la carga secuencial.
+ * @return: NULL.
+ */
+void *LeerLadosTrozo(void *trozo);
+
+/**
+ * @fun: CargaDatosArchivoParalelo(const char *ruta, u32 num_hilos).
+ * @param ruta: ruta de un archivo en formato DIMACS.
+ * @param num_hilos: cantidad de hilos a usar; 0 usa todos los procesadores.
+ * @brief: como CargaDatosArchivo(), pero divide los lados del archivo en
+ * trozos que terminan en fin de línea y los lee en paralelo. Los lados quedan
+ * en el mismo orden que en la carga secuencial y los errores se reportan
+ * para el mismo lado.
+ * @return: la estructura con los datos cargados; NULL si hubo errores.
+ */
+datos_t CargaDatosArchivoParalelo(const char *ruta, u32 num_hilos);
+
+#endif // CARGA_H
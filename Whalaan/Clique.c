@@ -0,0 +1,334 @@
+/**
+ * @file: Clique.c
+ * @brief: implementación de la clique heurística.
+ */
+
+#include "Arena.h"
+#include "Clique.h"
+#include "Comprimido.h"
+#include "Exacto.h"
+
+/**
+ * @fun: CrearBusquedaClique(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @return: una búsqueda sobre G sin ninguna clique; NULL si no hubo memoria.
+ */
+BusquedaClique *CrearBusquedaClique(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    size_t palabras = (CLIQUE_MAX_LOCAL + 63) / 64;
+    Arena *arena = ArenaCrear((size_t)numVertices * 7 * sizeof(u32) +
+                              (CLIQUE_MAX_LOCAL + 1) * palabras *
+                              sizeof(uint64_t), false);
+    if (arena == NULL) return NULL;
+    BusquedaClique *busqueda = ArenaAlocar(arena, sizeof(BusquedaClique));
+    if (busqueda == NULL) {
+        ArenaDestruir(arena);
+        return NULL;
+    }
+    busqueda->arena = arena;
+    busqueda->grafo = G;
+    busqueda->num_vertices = numVertices;
+    busqueda->degeneracion = 0;
+    busqueda->sello = 0;
+    busqueda->tamanio = 0;
+    busqueda->orden = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    busqueda->posicion = ArenaAlocar(arena, (size_t)numVertices *
+                                            sizeof(u32));
+    busqueda->nucleo = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    busqueda->marca = ArenaAlocarCeros(arena, numVertices, sizeof(u32));
+    busqueda->candidatos = ArenaAlocar(arena, (size_t)numVertices *
+                                              sizeof(u32));
+    busqueda->clique = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    busqueda->actual = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    busqueda->local = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    busqueda->vecindario = ArenaAlocar(arena, CLIQUE_MAX_LOCAL *
+                                              sizeof(u32));
+    busqueda->adyacencia = ArenaAlocar(arena, CLIQUE_MAX_LOCAL * palabras *
+                                              sizeof(uint64_t));
+    busqueda->conjunto = ArenaAlocar(arena, palabras * sizeof(uint64_t));
+    if (busqueda->orden == NULL || busqueda->posicion == NULL ||
+        busqueda->nucleo == NULL || busqueda->marca == NULL ||
+        busqueda->candidatos == NULL || busqueda->clique == NULL ||
+        busqueda->actual == NULL || busqueda->local == NULL ||
+        busqueda->vecindario == NULL || busqueda->adyacencia == NULL ||
+        busqueda->conjunto == NULL) {
+        ArenaDestruir(arena);
+        return NULL;
+    }
+    for (u32 v = 0; v < numVertices; v++) {
+        busqueda->local[v] = UINT_MAX;
+    }
+    return busqueda;
+}
+
+/**
+ * @fun: DestruirBusquedaClique(BusquedaClique *busqueda).
+ * @param busqueda: una búsqueda creada con CrearBusquedaClique(), o NULL.
+ * @brief: libera la búsqueda.
+ */
+void DestruirBusquedaClique(BusquedaClique *busqueda) {
+    if (busqueda != NULL) ArenaDestruir(busqueda->arena);
+}
+
+/**
+ * @fun: OrdenDegeneracion(BusquedaClique *busqueda).
+ * @param busqueda: una búsqueda.
+ * @brief: calcula el orden de degeneración y el número de núcleo de cada
+ * vértice con el algoritmo de Batagelj y Zaversnik: saca cada vez el vértice
+ * de menor grado entre los que quedan, con los vértices en baldes por grado.
+ * Cuesta O(n + m).
+ */
+void OrdenDegeneracion(BusquedaClique *busqueda) {
+    Grafo G = busqueda->grafo;
+    u32 numVertices = busqueda->num_vertices;
+    u32 *orden = busqueda->orden;
+    u32 *posicion = busqueda->posicion;
+    // El núcleo empieza siendo el grado, que baja a medida que se sacan
+    // vecinos. Los candidatos sirven de comienzo de cada balde: como el
+    // grado es menor que n, entran.
+    u32 *grado = busqueda->nucleo;
+    u32 *balde = busqueda->candidatos;
+    u32 delta = G->infoGrafo[DeltaGrande];
+    memset(balde, 0, ((size_t)delta + 1) * sizeof(u32));
+    for (u32 v = 0; v < numVertices; v++) {
+        grado[v] = G->infoVertices[Grado][v];
+        balde[grado[v]]++;
+    }
+    u32 comienzo = 0;
+    for (u32 d = 0; d <= delta; d++) {
+        u32 cantidad = balde[d];
+        balde[d] = comienzo;
+        comienzo += cantidad;
+    }
+    for (u32 v = 0; v < numVertices; v++) {
+        posicion[v] = balde[grado[v]]++;
+        orden[posicion[v]] = v;
+    }
+    for (u32 d = delta; d > 0; d--) {
+        balde[d] = balde[d - 1];
+    }
+    balde[0] = 0;
+    busqueda->degeneracion = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 v = orden[i];
+        if (grado[v] > busqueda->degeneracion) {
+            busqueda->degeneracion = grado[v];
+        }
+        const u32 *vecinos_v = VecinosEnCache(G, v);
+        for (u32 j = 0; j < G->infoVertices[Grado][v]; j++) {
+            u32 u = vecinos_v[j];
+            if (grado[u] > grado[v]) {
+                // u pasa al comienzo de su balde y el balde se achica.
+                u32 grado_u = grado[u];
+                u32 primero = orden[balde[grado_u]];
+                if (u != primero) {
+                    u32 posicion_u = posicion[u];
+                    orden[posicion_u] = primero;
+                    posicion[primero] = posicion_u;
+                    orden[balde[grado_u]] = u;
+                    posicion[u] = balde[grado_u];
+                }
+                balde[grado_u]++;
+                grado[u]--;
+            }
+        }
+    }
+}
+
+/**
+ * @fun: CliqueGreedyVecinos(BusquedaClique *busqueda, u32 v).
+ * @param busqueda: una búsqueda con el orden de degeneración.
+ * @param v: un vértice.
+ * @brief: arma una clique con v y sus vecinos posteriores en el orden de
+ * degeneración, agregando cada vez el candidato de mayor núcleo. Sólo son
+ * candidatos los vértices de núcleo suficiente para superar la mejor clique,
+ * y corta en cuanto la clique más los candidatos no la superan. Si la supera,
+ * pasa a ser la mejor.
+ */
+void CliqueGreedyVecinos(BusquedaClique *busqueda, u32 v) {
+    Grafo G = busqueda->grafo;
+    u32 *candidatos = busqueda->candidatos;
+    u32 *posicion = busqueda->posicion;
+    u32 mejor = busqueda->tamanio;
+    u32 num_candidatos = 0;
+    const u32 *vecinos = VecinosEnCache(G, v);
+    for (u32 j = 0; j < G->infoVertices[Grado][v]; j++) {
+        u32 u = vecinos[j];
+        if (posicion[u] > posicion[v] && busqueda->nucleo[u] >= mejor) {
+            candidatos[num_candidatos++] = u;
+        }
+    }
+    u32 tamanio = 0;
+    busqueda->actual[tamanio++] = v;
+    while (num_candidatos > 0 && tamanio + num_candidatos > mejor) {
+        // Con el orden de degeneración, el núcleo crece con la posición.
+        u32 elegido = 0;
+        for (u32 i = 1; i < num_candidatos; i++) {
+            if (posicion[candidatos[i]] > posicion[candidatos[elegido]]) {
+                elegido = i;
+            }
+        }
+        u32 u = candidatos[elegido];
+        busqueda->actual[tamanio++] = u;
+        busqueda->sello++;
+        vecinos = VecinosEnCache(G, u);
+        for (u32 j = 0; j < G->infoVertices[Grado][u]; j++) {
+            busqueda->marca[vecinos[j]] = busqueda->sello;
+        }
+        u32 quedan = 0;
+        for (u32 i = 0; i < num_candidatos; i++) {
+            if (busqueda->marca[candidatos[i]] == busqueda->sello) {
+                candidatos[quedan++] = candidatos[i];
+            }
+        }
+        num_candidatos = quedan;
+    }
+    if (num_candidatos == 0 && tamanio > mejor) {
+        busqueda->tamanio = tamanio;
+        memcpy(busqueda->clique, busqueda->actual,
+               (size_t)tamanio * sizeof(u32));
+    }
+}
+
+/**
+ * @fun: RefinarCliqueBits(BusquedaClique *busqueda, u32 v).
+ * @param busqueda: una búsqueda con el orden de degeneración.
+ * @param v: un vértice.
+ * @brief: arma la matriz de adyacencia en bits de los vecinos posteriores de
+ * v con núcleo suficiente para superar la mejor clique, si son a lo sumo
+ * CLIQUE_MAX_LOCAL, y corre CliqueGreedyDesde() empezando en cada uno. Si
+ * alguna clique más v supera a la mejor, pasa a ser la mejor.
+ * @return: true si armó la matriz; false si v tiene pocos o demasiados
+ * vecinos para eso.
+ */
+bool RefinarCliqueBits(BusquedaClique *busqueda, u32 v) {
+    Grafo G = busqueda->grafo;
+    u32 mejor = busqueda->tamanio;
+    u32 num_local = 0;
+    const u32 *vecinos = VecinosEnCache(G, v);
+    for (u32 j = 0; j < G->infoVertices[Grado][v]; j++) {
+        u32 u = vecinos[j];
+        if (busqueda->posicion[u] > busqueda->posicion[v] &&
+            busqueda->nucleo[u] >= mejor) {
+            if (num_local == CLIQUE_MAX_LOCAL) {
+                num_local++;
+                break;
+            }
+            busqueda->vecindario[num_local++] = u;
+        }
+    }
+    if (num_local + 1 <= mejor || num_local > CLIQUE_MAX_LOCAL) return false;
+    u32 palabras = (num_local + 63) / 64;
+    for (u32 i = 0; i < num_local; i++) {
+        busqueda->local[busqueda->vecindario[i]] = i;
+    }
+    memset(busqueda->adyacencia, 0,
+           (size_t)num_local * palabras * sizeof(uint64_t));
+    for (u32 i = 0; i < num_local; i++) {
+        u32 u = busqueda->vecindario[i];
+        uint64_t *fila = busqueda->adyacencia + (size_t)i * palabras;
+        vecinos = VecinosEnCache(G, u);
+        for (u32 j = 0; j < G->infoVertices[Grado][u]; j++) {
+            u32 indice = busqueda->local[vecinos[j]];
+            if (indice != UINT_MAX) {
+                fila[indice / 64] |= (uint64_t)1 << (indice % 64);
+            }
+        }
+    }
+    for (u32 i = 0; i < num_local; i++) {
+        busqueda->local[busqueda->vecindario[i]] = UINT_MAX;
+    }
+    // El vecindario se recorre como una búsqueda exacta sobre él, sin
+    // colores.
+    BusquedaExacta exacta;
+    memset(&exacta, 0, sizeof(BusquedaExacta));
+    exacta.num_vertices = num_local;
+    exacta.palabras = palabras;
+    exacta.adyacencia = busqueda->adyacencia;
+    exacta.candidatos = busqueda->conjunto;
+    u32 *clique_local = busqueda->candidatos;
+    for (u32 i = 0; i < num_local; i++) {
+        // Junto con v, alcanza una clique local de tamanio vértices.
+        u32 minimo = busqueda->tamanio > 0 ? busqueda->tamanio - 1 : 0;
+        u32 tamanio = CliqueGreedyDesde(&exacta, i, minimo, clique_local);
+        if (tamanio + 1 > busqueda->tamanio) {
+            busqueda->clique[0] = v;
+            for (u32 x = 0; x < tamanio; x++) {
+                busqueda->clique[x + 1] = busqueda->vecindario[clique_local[x]];
+            }
+            busqueda->tamanio = tamanio + 1;
+        }
+    }
+    return true;
+}
+
+/**
+ * @fun: ComienzoDeCapa(const BusquedaClique *busqueda, u32 fin).
+ * @param busqueda: una búsqueda con el orden de degeneración.
+ * @param fin: una posición de orden mayor que 0.
+ * @return: la primera posición de orden con el mismo núcleo que la posición
+ * fin - 1; como el núcleo no baja a lo largo del orden, las posiciones entre
+ * las dos son toda esa capa.
+ */
+u32 ComienzoDeCapa(const BusquedaClique *busqueda, u32 fin) {
+    u32 capa = busqueda->nucleo[busqueda->orden[fin - 1]];
+    u32 comienzo = fin - 1;
+    while (comienzo > 0 &&
+           busqueda->nucleo[busqueda->orden[comienzo - 1]] == capa) {
+        comienzo--;
+    }
+    return comienzo;
+}
+
+/**
+ * @fun: CotaInferiorClique(Grafo G, u32 clique[]).
+ * @param G: un grafo correctamente construido.
+ * @param clique: arreglo de al menos delta grande + 1 elementos donde se
+ * guardan los vértices de la clique; puede ser NULL.
+ * @brief: busca una clique grande sin garantizar que sea máxima. Recorre las
+ * capas de núcleo de mayor a menor con CliqueGreedyVecinos(), hasta que el
+ * núcleo no alcanza para superar la mejor clique o la clique llega a la
+ * degeneración más uno, y después refina con RefinarCliqueBits() los primeros
+ * CLIQUE_INICIOS_REFINADOS vértices del mismo recorrido.
+ * Como la clique necesita un color por vértice, su tamaño acota por abajo el
+ * número cromático; si un coloreo lo alcanza, es óptimo.
+ * @return: el tamaño de la clique; 0 si no hubo memoria.
+ */
+u32 CotaInferiorClique(Grafo G, u32 clique[]) {
+    BusquedaClique *busqueda = CrearBusquedaClique(G);
+    if (busqueda == NULL) return 0;
+    OrdenDegeneracion(busqueda);
+    // Las capas se recorren de mayor a menor núcleo, y cada una en el orden
+    // de degeneración, porque sus primeros vértices son los que tienen más
+    // vecinos posteriores. Con la degeneración alcanzada la clique ya es
+    // máxima.
+    u32 fin = busqueda->num_vertices;
+    while (fin > 0 && busqueda->tamanio <= busqueda->degeneracion &&
+           busqueda->nucleo[busqueda->orden[fin - 1]] >= busqueda->tamanio) {
+        u32 comienzo = ComienzoDeCapa(busqueda, fin);
+        for (u32 i = comienzo;
+             i < fin && busqueda->tamanio <= busqueda->degeneracion; i++) {
+            CliqueGreedyVecinos(busqueda, busqueda->orden[i]);
+        }
+        fin = comienzo;
+    }
+    u32 refinados = 0;
+    fin = busqueda->num_vertices;
+    while (fin > 0 && refinados < CLIQUE_INICIOS_REFINADOS &&
+           busqueda->tamanio <= busqueda->degeneracion &&
+           busqueda->nucleo[busqueda->orden[fin - 1]] >= busqueda->tamanio) {
+        u32 comienzo = ComienzoDeCapa(busqueda, fin);
+        for (u32 i = comienzo; i < fin &&
+             refinados < CLIQUE_INICIOS_REFINADOS &&
+             busqueda->tamanio <= busqueda->degeneracion; i++) {
+            if (RefinarCliqueBits(busqueda, busqueda->orden[i])) refinados++;
+        }
+        fin = comienzo;
+    }
+    u32 tamanio = busqueda->tamanio;
+    if (clique != NULL) {
+        memcpy(clique, busqueda->clique, (size_t)tamanio * sizeof(u32));
+    }
+    DestruirBusquedaClique(busqueda);
+    return tamanio;
+}
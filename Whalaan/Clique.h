@@ -0,0 +1,125 @@
+/**
+ * @file: Clique.h
+ * @brief: fichero de la clique heurística: una clique grande encontrada
+ * rápido, cuyo tamaño acota por abajo el número cromático.
+ */
+
+#ifndef CLIQUE_H
+#define CLIQUE_H
+
+#include <stdint.h>
+
+#include "Rii.h"
+
+// Máximo de vecinos de un vértice que se refinan con una matriz en bits;
+// la matriz ocupa a lo sumo CLIQUE_MAX_LOCAL^2 bits.
+#define CLIQUE_MAX_LOCAL 1024
+
+// Cantidad de vértices, de los de mayor núcleo, cuyo vecindario se refina.
+#define CLIQUE_INICIOS_REFINADOS 8
+
+// Estado de la búsqueda de la clique heurística.
+typedef struct _BusquedaClique_ {
+    Grafo grafo;
+    u32 num_vertices;
+    // Orden de degeneración: cada vértice tiene a lo sumo nucleo[v] vecinos
+    // después de él. posicion[v] es el lugar de v en orden.
+    u32 *orden;
+    u32 *posicion;
+    u32 *nucleo;
+    u32 degeneracion;
+    // Marcas de los vecinos del último vértice agregado a la clique.
+    u32 *marca;
+    u32 sello;
+    // Candidatos de la clique que se está armando.
+    u32 *candidatos;
+    // Mejor clique encontrada y su tamaño, y la que se está armando.
+    u32 *clique;
+    u32 tamanio;
+    u32 *actual;
+    // Vecindario que se refina: índice local de cada vértice, o UINT_MAX si
+    // no está, sus vértices, su matriz de adyacencia en bits y un conjunto
+    // auxiliar.
+    u32 *local;
+    u32 *vecindario;
+    uint64_t *adyacencia;
+    uint64_t *conjunto;
+    struct _Arena_ *arena;
+} BusquedaClique;
+
+/**
+ * @fun: CrearBusquedaClique(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @return: una búsqueda sobre G sin ninguna clique; NULL si no hubo memoria.
+ */
+BusquedaClique *CrearBusquedaClique(Grafo G);
+
+/**
+ * @fun: DestruirBusquedaClique(BusquedaClique *busqueda).
+ * @param busqueda: una búsqueda creada con CrearBusquedaClique(), o NULL.
+ * @brief: libera la búsqueda.
+ */
+void DestruirBusquedaClique(BusquedaClique *busqueda);
+
+/**
+ * @fun: OrdenDegeneracion(BusquedaClique *busqueda).
+ * @param busqueda: una búsqueda.
+ * @brief: calcula el orden de degeneración y el número de núcleo de cada
+ * vértice con el algoritmo de Batagelj y Zaversnik: saca cada vez el vértice
+ * de menor grado entre los que quedan, con los vértices en baldes por grado.
+ * Cuesta O(n + m).
+ */
+void OrdenDegeneracion(BusquedaClique *busqueda);
+
+/**
+ * @fun: CliqueGreedyVecinos(BusquedaClique *busqueda, u32 v).
+ * @param busqueda: una búsqueda con el orden de degeneración.
+ * @param v: un vértice.
+ * @brief: arma una clique con v y sus vecinos posteriores en el orden de
+ * degeneración, agregando cada vez el candidato de mayor núcleo. Sólo son
+ * candidatos los vértices de núcleo suficiente para superar la mejor clique,
+ * y corta en cuanto la clique más los candidatos no la superan. Si la supera,
+ * pasa a ser la mejor.
+ */
+void CliqueGreedyVecinos(BusquedaClique *busqueda, u32 v);
+
+/**
+ * @fun: RefinarCliqueBits(BusquedaClique *busqueda, u32 v).
+ * @param busqueda: una búsqueda con el orden de degeneración.
+ * @param v: un vértice.
+ * @brief: arma la matriz de adyacencia en bits de los vecinos posteriores de
+ * v con núcleo suficiente para superar la mejor clique, si son a lo sumo
+ * CLIQUE_MAX_LOCAL, y corre CliqueGreedyDesde() empezando en cada uno. Si
+ * alguna clique más v supera a la mejor, pasa a ser la mejor.
+ * @return: true si armó la matriz; false si v tiene pocos o demasiados
+ * vecinos para eso.
+ */
+bool RefinarCliqueBits(BusquedaClique *busqueda, u32 v);
+
+/**
+ * @fun: ComienzoDeCapa(const BusquedaClique *busqueda, u32 fin).
+ * @param busqueda: una búsqueda con el orden de degeneración.
+ * @param fin: una posición de orden mayor que 0.
+ * @return: la primera posición de orden con el mismo núcleo que la posición
+ * fin - 1; como el núcleo no baja a lo largo del orden, las posiciones entre
+ * las dos son toda esa capa.
+ */
+u32 ComienzoDeCapa(const BusquedaClique *busqueda, u32 fin);
+
+/**
+ * @fun: CotaInferiorClique(Grafo G, u32 clique[]).
+ * @param G: un grafo correctamente construido.
+ * @param clique: arreglo de al menos delta grande + 1 elementos donde se
+ * guardan los vértices de la clique; puede ser NULL.
+ * @brief: busca una clique grande sin garantizar que sea máxima. Recorre las
+ * capas de núcleo de mayor a menor con CliqueGreedyVecinos(), hasta que el
+ * núcleo no alcanza para superar la mejor clique o la clique llega a la
+ * degeneración más uno, y después refina con RefinarCliqueBits() los primeros
+ * CLIQUE_INICIOS_REFINADOS vértices del mismo recorrido.
+ * Como la clique necesita un color por vértice, su tamaño acota por abajo el
+ * número cromático; si un coloreo lo alcanza, es óptimo.
+ * @return: el tamaño de la clique; 0 si no hubo memoria.
+ */
+u32 CotaInferiorClique(Grafo G, u32 clique[]);
+
+#endif // CLIQUE_H
@@ -3,117 +3,103 @@
  * @brief: implmentación de las funciones para colorear el grafo.
  */
 
+#include "Arena.h"
+#include "Coloreo.h"
+#include "Comprimido.h"
 #include "Ordenacion.h"
 #include "Rii.h"
-#include "Lista.h"
+#include "Vectorial.h"
 
 /**
- * @fun: Bipartito(Grafo G).
+ * @fun: BipartitoConEspacio(Grafo G, Espacio E).
  * @param G: un grafo correctamente construido.
- * @return: devuelve 1 si G es bipartito, 0 si no.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como Bipartito(), usando la cola de E para el BFS y E para
+ * colorear con Greedy si G no es bipartito.
+ * @return: devuelve 1 si G es bipartito, 0 si no o si E no alcanza para G.
  */
-
-int Bipartito(Grafo G) {
+int BipartitoConEspacio(Grafo G, Espacio E) {
     // Número de vértices coloreados.
-    u32 num_vertices_coloreados,
-    // Puntero para señalar a un vértice sin colorear.
-        *vert_sin_color = NULL, 
-    // Puntero para señalar a los vecinos de un vértice.
-        *vecino,
-    // Puntero para el vértice que esta primero en la cola.
-        *indice_primero;
-    // Lista que será usada con semántica de cola.
-        lista_t *lista;
-    // Puntero a un vértice.
-        VerticeSt *vertice;
-    // Variable de control para el agregado de elementos en la cola.
-    bool insertado;
+    u32 num_vertices_coloreados;
+    // Índice de un vértice.
+    u32 vertice;
+    // Índices de los vecinos del vértice.
+    const u32 *vecinos_v;
     // Al comenzar tenemos 0 vertices coloreados.
     num_vertices_coloreados = 0;
     // Si G es NULL, no podemos aplicar el algoritmo.
     char error = false;
     if (G == NULL) return 0;
+    // Verificamos que la cola del espacio de trabajo alcance.
+    if (VerificarEspacio(E, G)) return 0;
+    // Cola del BFS. Cada vértice se encola una sola vez, cuando se lo
+    // colorea, así que alcanza con un lugar por vértice para todas las
+    // componentes: frente es el primero de la cola y fin el lugar siguiente
+    // al último.
+    u32 *cola = E->cola;
+    u32 frente = 0, fin = 0;
+    // Arreglo con el color de cada vértice.
+    u32 *colores = G->infoVertices[Color];
    // max se utiliza para decir q no tiene color un vertice.
     u32 max = G->infoGrafo[Vertices];
-    if (G->infoGrafo[Colores] != 0) {
-        for (u32 i = 0; i < G->infoGrafo[Vertices]; i++) {
-            G->array_vertices[i].infoVertice[Color] = max;
-        }
-        // Establecemos que no hay colores en el grafo.
-        G->infoGrafo[Colores] = 0;
+    for (u32 i = 0; i < G->infoGrafo[Vertices]; i++) {
+        colores[i] = max;
     }
-    // Creamos una nueva lista.
-    lista = lista_crear();
+    // Establecemos que no hay colores en el grafo.
+    G->infoGrafo[Colores] = 0;
+    // Los vértices anteriores a sin_color ya están coloreados.
+    u32 sin_color = 0;
     // Mientras no terminamos de colorear todos los vértices,
     // permanecemos en el ciclo.
     while (num_vertices_coloreados < G->infoGrafo[Vertices]) {
-        // Se busca vértice no coloreado, recorriendo el arreglo de vértices.
-        for (u32 i = 0; i < G->infoGrafo[Vertices]; i++) {
-            // Si el vértice no está coloreado, entonces 
-            //guardamos el indice de dicho vertice.
-            if (G->array_vertices[i].infoVertice[Color] == max) {
-                //Alocamos memoria el índice del vértice sin color.
-                vert_sin_color = calloc(1, sizeof(u32));
-                *vert_sin_color = i;
-                break;
-            }
+        // Se busca vértice no coloreado, recorriendo el arreglo de vértices
+        // desde el último encontrado.
+        while (colores[sin_color] != max) {
+            sin_color++;
         }
         // Le ponemos color 0 a dicho vértice.
-        G->array_vertices[*vert_sin_color].infoVertice[Color] = 0;
+        colores[sin_color] = 0;
         // Aumentamos la cantidad de vértices coloreados.
         num_vertices_coloreados++;
-        // Agrego el índice del vértice a una cola para realizar el BFS.
-        insertado = lista_insertar_ultimo(lista, vert_sin_color);
-        // Si no se insertó a la cola es un error.
-        if (insertado == false) {
-            break;
-        }
+        // Agrego el índice del vértice a la cola para realizar el BFS.
+        cola[fin++] = sin_color;
         // Mientras haya elementos en la cola...
-        while (!lista_esta_vacia(lista)) {
-            // Tomo el primer vértice de la cola y lo elimino de la misma.
-            indice_primero = lista_borrar_primero(lista);
-            // Señalo al vértice que saque de la cola.
-            vertice = &(G->array_vertices[*indice_primero]);
-            free(indice_primero);
+        while (frente < fin) {
+            // Tomo el primer vértice de la cola y lo saco de la misma.
+            vertice = cola[frente++];
+            // Y sus vecinos, decodificados si están comprimidos.
+            vecinos_v = VecinosEnCache(G, vertice);
             // Recorro los vecinos del vértice.
-            for (u32 i = 0; i < vertice->infoVertice[Grado]; i++) { 
-                // Alocamos memoria para el índice del vértice.
-                vecino = calloc(1, sizeof(u32));
-                *vecino = vertice->vecinos_v[i];     
+            for (u32 i = 0; i < G->infoVertices[Grado][vertice]; i++) {
+                u32 vecino = vecinos_v[i];
                 //Si el vecino del vértice no tiene color,lo agregamos a la cola
-                if (G->array_vertices[*vecino].infoVertice[Color] == max) {
-                    insertado = lista_insertar_ultimo(lista, vecino);
+                if (colores[vecino] == max) {
+                    cola[fin++] = vecino;
                     // Incrementamos la cantidad de vértices coloreados.
                     num_vertices_coloreados++;
                     // Le ponemos un color que este entre 0 y 1,
-                    // según vertice->infoVertice[Color]
-                    G->array_vertices[*vecino].infoVertice[Color] = 
-                                                1 - vertice->infoVertice[Color];
-                }
-                else {
-                    free(vecino);
+                    // según el color del vértice.
+                    colores[vecino] = 1 - colores[vertice];
                 }
             }
             // Actualizamos la cantidad de colores.
-            if (G->infoGrafo[Colores] < vertice->infoVertice[Color]) {
-                G->infoGrafo[Colores] = vertice->infoVertice[Color];
+            if (G->infoGrafo[Colores] < colores[vertice]) {
+                G->infoGrafo[Colores] = colores[vertice];
             }
         }
     }
-    // Si ya terminamos de colorear destruimos la lista.
-   	lista_destruir(lista, free);
     // Verificamos si hay dos vértices que sean vecinos y tengan el mismo color.
     for (u32 i = 0; i < G->infoGrafo[Vertices]; i++) {
-        vertice = &(G->array_vertices[i]);
-        for (u32 j = 0; j < vertice->infoVertice[Grado]; j++) {
+        vertice = i;
+        vecinos_v = VecinosEnCache(G, i);
+        for (u32 j = 0; j < G->infoVertices[Grado][vertice]; j++) {
             // No es bipartito si algún vecino tiene el mismo color que vertice.
-            u32 vertice_vecino =
-                    G->array_vertices[vertice->vecinos_v[j]].infoVertice[Color];
-            if (vertice->infoVertice[Color] == vertice_vecino) {
-                error = OrdenWelshPowell(G);
+            u32 vertice_vecino = colores[vecinos_v[j]];
+            if (colores[vertice] == vertice_vecino) {
+                error = OrdenWelshPowellConEspacio(G, E);
                 if (error) return 0;
-                Greedy(G);
-				        return 0;
+                GreedyConEspacio(G, E);
+                return 0;
             }
         }
     }
@@ -121,92 +107,823 @@ int Bipartito(Grafo G) {
     return 1;
 }
 
+/**
+ * @fun: Bipartito(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: usa BipartitoConEspacio() con el espacio de trabajo de G.
+ * @return: devuelve 1 si G es bipartito, 0 si no.
+ */
+int Bipartito(Grafo G) {
+    if (G == NULL) return 0;
+    return BipartitoConEspacio(G, EspacioDelGrafo(G));
+}
+
+/**
+ * @fun: PrepararGreedy(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: deja a todos los vértices sin color y la cantidad de vértices de
+ * cada color en cero, antes de colorear con Greedy.
+ */
+void PrepararGreedy(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    // Seteamos todos los colores de los vértices con UINT_MAX, lo cual
+    // indicará la ausencia de color, ya que el 0 puede ser un color.
+    for (u32 i = 0; i < numVertices; i++) {
+        colores[i] = UINT_MAX;
+    }
+    // Seteamos la cantidad de colores usados en el grafo para volver a
+    // contabilizar en este nuevo coloreo; por el teorema sabemos que Greedy
+    // en cualquier orden colorea con a lo sumo delta grande + 1 colores.
+    memset(G->array_cantidad_colores, 0,
+           ((size_t)G->infoGrafo[DeltaGrande] + 1) * sizeof(u32));
+}
+
+/**
+ * @fun: GreedyConMarcas(Grafo G, u32 marcas[], u32 *generacion).
+ * @param G: un grafo correctamente construido.
+ * @param marcas: arreglo de delta grande + 1 elementos; marcas[c] es la
+ * generación en la que el color c se vio por última vez en un vecino.
+ * @param generacion: última generación usada con marcas; se incrementa una
+ * vez por vértice.
+ * @brief: colorea G con Greedy en el orden dado. Cada vértice usa una
+ * generación nueva, así que los colores prohibidos del vértice anterior
+ * quedan descartados sin limpiar el arreglo; sólo se limpia cuando la
+ * generación da la vuelta. Lee los arreglos internos del grafo
+ * directamente.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMarcas(Grafo G, u32 marcas[], u32 *generacion) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 delta = G->infoGrafo[DeltaGrande];
+    // Arreglo con el color de cada vértice; es el único dato de los vecinos
+    // que se lee, y al estar contiguo no se traen nombres ni grados a la
+    // caché.
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *orden = G->array_orden_vertices;
+    u32 *cantidad = G->array_cantidad_colores;
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    u32 marca = *generacion;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 indice_i = orden[i];
+        // Generación del vértice i: sólo los colores marcados con ella están
+        // prohibidos. Si da la vuelta, las marcas viejas podrían confundirse
+        // con las nuevas, así que se limpian.
+        if (++marca == 0) {
+            memset(marcas, 0, ((size_t)delta + 1) * sizeof(u32));
+            marca = 1;
+        }
+        // Marcamos los colores de los vecinos ya coloreados.
+        u32 grado_i = grados[indice_i];
+        const u32 *vecinos_i = VecinosEnCache(G, indice_i);
+        for (u32 j = 0; j < grado_i; j++) {
+            u32 color_vecino_j = colores[vecinos_i[j]];
+            if (color_vecino_j != UINT_MAX) marcas[color_vecino_j] = marca;
+        }
+        // El vértice toma el menor color no marcado, que es a lo sumo su
+        // grado.
+        u32 color_i = 0;
+        while (marcas[color_i] == marca) {
+            color_i++;
+        }
+        colores[indice_i] = color_i;
+        cantidad[color_i]++;
+        if (color_i + 1 > num_colores) num_colores = color_i + 1;
+    }
+    *generacion = marca;
+    G->infoGrafo[Colores] = num_colores;
+    return num_colores;
+}
+
+/**
+ * @fun: MascaraVecinos(const u32 colores[], const u32 vecinos[], u32 grado).
+ * @param colores: color de cada vértice, menor a COLORES_MASCARA o UINT_MAX.
+ * @param vecinos: índices de los vecinos de un vértice.
+ * @param grado: cantidad de vecinos.
+ * @return: palabra con el bit c prendido si algún vecino tiene color c.
+ */
+uint64_t MascaraVecinos(const u32 colores[], const u32 vecinos[], u32 grado) {
+    // Un vecino sin color (UINT_MAX) aporta un 0, así que no hace falta
+    // preguntar.
+    uint64_t prohibidos = 0;
+    for (u32 j = 0; j < grado; j++) {
+        u32 color_vecino_j = colores[vecinos[j]];
+        prohibidos |= (uint64_t)(color_vecino_j != UINT_MAX)
+                      << (color_vecino_j & (COLORES_MASCARA - 1));
+    }
+    return prohibidos;
+}
+
+/**
+ * @fun: MascarasVecinos(const u32 colores[], const u32 vecinos[], u32 grado,
+ *                       uint64_t prohibidos[]).
+ * @param colores: color de cada vértice, menor a COLORES_MASCARAS o
+ * UINT_MAX.
+ * @param vecinos: índices de los vecinos de un vértice.
+ * @param grado: cantidad de vecinos.
+ * @param prohibidos: PALABRAS_MASCARAS palabras donde se prenden los bits de
+ * los colores de los vecinos, sin borrar los que ya estaban.
+ */
+void MascarasVecinos(const u32 colores[], const u32 vecinos[], u32 grado,
+                     uint64_t prohibidos[]) {
+    // Igual que en MascaraVecinos(), un vecino sin color prende un 0 en
+    // alguna palabra. Los vecinos se toman de a dos y cada uno prende su bit
+    // en un juego distinto de palabras, que se juntan al final; así cada
+    // vecino no espera a que se escriba la palabra del anterior.
+    uint64_t prohibidos_impares[PALABRAS_MASCARAS] = {0};
+    u32 j = 0;
+    for (; j + 1 < grado; j += 2) {
+        u32 color_par = colores[vecinos[j]];
+        u32 color_impar = colores[vecinos[j + 1]];
+        prohibidos[(color_par / COLORES_MASCARA) % PALABRAS_MASCARAS] |=
+                (uint64_t)(color_par != UINT_MAX)
+                << (color_par % COLORES_MASCARA);
+        prohibidos_impares[(color_impar / COLORES_MASCARA) %
+                           PALABRAS_MASCARAS] |=
+                (uint64_t)(color_impar != UINT_MAX)
+                << (color_impar % COLORES_MASCARA);
+    }
+    if (j < grado) {
+        u32 color_par = colores[vecinos[j]];
+        prohibidos[(color_par / COLORES_MASCARA) % PALABRAS_MASCARAS] |=
+                (uint64_t)(color_par != UINT_MAX)
+                << (color_par % COLORES_MASCARA);
+    }
+    for (u32 k = 0; k < PALABRAS_MASCARAS; k++) {
+        prohibidos[k] |= prohibidos_impares[k];
+    }
+}
+
+/**
+ * @fun: PrimerColorLibre(const uint64_t prohibidos[]).
+ * @param prohibidos: PALABRAS_MASCARAS palabras de colores prohibidos, con
+ * algún bit libre.
+ * @return: el menor color cuyo bit no está prendido.
+ */
+u32 PrimerColorLibre(const uint64_t prohibidos[]) {
+    u32 palabra = 0;
+    while (prohibidos[palabra] == ~(uint64_t)0) {
+        palabra++;
+    }
+    return palabra * COLORES_MASCARA +
+           (u32)__builtin_ctzll(~prohibidos[palabra]);
+}
+
+/**
+ * @fun: GreedyConMascara(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARA.
+ * @brief: colorea G con Greedy en el orden dado, juntando los colores
+ * prohibidos de cada vértice en los bits de una palabra, sin ramas, y
+ * eligiendo el primer bit libre con una sola instrucción.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMascara(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *orden = G->array_orden_vertices;
+    u32 *cantidad = G->array_cantidad_colores;
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 indice_i = orden[i];
+        uint64_t prohibidos = MascaraVecinos(colores,
+                                             VecinosEnCache(G, indice_i),
+                                             grados[indice_i]);
+        // Hay a lo sumo delta grande < 64 bits prendidos, así que el
+        // complemento tiene algún bit prendido, y el más bajo es el color.
+        u32 color_i = (u32)__builtin_ctzll(~prohibidos);
+        colores[indice_i] = color_i;
+        cantidad[color_i]++;
+        if (color_i + 1 > num_colores) num_colores = color_i + 1;
+    }
+    G->infoGrafo[Colores] = num_colores;
+    return num_colores;
+}
+
+/**
+ * @fun: GreedyConMascaras(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARAS.
+ * @brief: como GreedyConMascara(), con PALABRAS_MASCARAS palabras de colores
+ * prohibidos; se busca el primer bit libre palabra por palabra.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMascaras(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *orden = G->array_orden_vertices;
+    u32 *cantidad = G->array_cantidad_colores;
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 indice_i = orden[i];
+        uint64_t prohibidos[PALABRAS_MASCARAS] = {0};
+        MascarasVecinos(colores, VecinosEnCache(G, indice_i),
+                        grados[indice_i], prohibidos);
+        // Como en GreedyConMascara(), alguna palabra tiene un bit libre.
+        u32 color_i = PrimerColorLibre(prohibidos);
+        colores[indice_i] = color_i;
+        cantidad[color_i]++;
+        if (color_i + 1 > num_colores) num_colores = color_i + 1;
+    }
+    G->infoGrafo[Colores] = num_colores;
+    return num_colores;
+}
+
+/**
+ * @fun: GreedyConEspacio(Grafo G, Espacio E).
+ * @param G: un grafo correctamente construido.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: si delta grande es chico usa GreedyConMascara() o
+ * GreedyConMascaras(), que no necesitan E; si no, GreedyConMarcas() con las
+ * marcas de E. Si el procesador lo permite y el grafo tiene suficientes
+ * vecinos por vértice, usa sus versiones vectoriales. En ningún caso aloca
+ * memoria.
+ * @return: el número de colores obtenido; 0 si hace falta E y no alcanza
+ * para G.
+ */
+u32 GreedyConEspacio(Grafo G, Espacio E) {
+    u32 delta = G->infoGrafo[DeltaGrande];
+    enum NivelVectorial nivel = UsarNivelVectorial(G);
+    if (delta < COLORES_MASCARA) {
+        // Con 64 colores el gather de 8 vecinos rinde más que el de 16.
+        if (nivel != VectorialEscalar) return GreedyConMascaraAVX2(G);
+        return GreedyConMascara(G);
+    }
+    if (delta < COLORES_MASCARAS) {
+        if (nivel == VectorialAVX512 &&
+            G->infoGrafo[Vertices] <= VERTICES_MASCARAS_VECTORIAL) {
+            return GreedyConMascarasAVX512(G);
+        }
+        return GreedyConMascaras(G);
+    }
+    if (VerificarEspacio(E, G)) return 0;
+    // GreedyConMarcas() sólo limpia las marcas de los colores de G, pero E
+    // pudo usarse con grafos de delta grande mayor. Si la generación puede
+    // dar la vuelta en este coloreo se limpian todas antes de empezar.
+    if (E->generacion > UINT_MAX - G->infoGrafo[Vertices]) {
+        memset(E->marcas, 0, (size_t)E->capacidad_colores * sizeof(u32));
+        E->generacion = 0;
+    }
+    if (nivel == VectorialAVX512) {
+        return GreedyConMarcasAVX512(G, E->marcas, &E->generacion);
+    }
+    return GreedyConMarcas(G, E->marcas, &E->generacion);
+}
+
 /**
  * @fun: Greedy(Grafo G).
  * @param G: un grafo correctamente construido.
+ * @brief: usa GreedyConEspacio() con el espacio de trabajo de G, que se crea
+ * la primera vez y se reutiliza en las llamadas siguientes.
  * @return: devuelve el número de colores que se obtiene al correr Greedy en
- * algún orden.
+ * algún orden; 0 si no hubo memoria.
  */
 u32 Greedy(Grafo G) {
-    // Arreglo para indicar los colores usados. Con calloc lo inicializamos
-    // en false para todas sus posiciones. La posicion i del arreglo
-    // representará el color i; si fue usado entonces tendra un true y si no
-    // lo fue, un false.
-    // Por el teorema sabemos que Greedy en cualquier orden colorea con a lo
-    // sumo delta grande + 1 colores. Asi que nunca podrán usarse mas de
-    // estos colores.
-    bool *colores_usados = calloc(G->infoGrafo[DeltaGrande]+1, sizeof(bool));
-    // Seteamos todos los colores de los vértices con UINT_MAX, el
-    // máximo valor para una variable u32, lo cual indicará la ausencia de
-    // color. Usamos esto porque el 0 puede ser un color y porque asumimos
-    // que para que un grafo tenga el color UINT_MAX este sería demasiado
-    // grande e inmanejable.
-    u32 numVertices = NumeroDeVertices(G);
+    return GreedyConEspacio(G, EspacioDelGrafo(G));
+}
+
+/**
+ * @fun: CrearColaSaturacion(struct _Arena_ *arena, const u32 grados[],
+ *                           u32 numVertices, u32 delta).
+ * @param arena: arena de la que salen los arreglos de la cola.
+ * @param grados: grado de cada vértice.
+ * @param numVertices: cantidad de vértices.
+ * @param delta: grado máximo.
+ * @brief: ordena los vértices por grado decreciente, y entre los de igual
+ * grado por índice, y crea una cola con todos en saturación 0. Como un
+ * vértice de grado d nunca pasa de saturación d, el conjunto de la
+ * saturación s sólo necesita un bit por cada vértice de grado al menos s:
+ * entre todas las saturaciones, 2 * lados + vértices bits.
+ * @return: la cola; NULL si no hubo memoria.
+ */
+ColaSaturacion *CrearColaSaturacion(struct _Arena_ *arena, const u32 grados[],
+                                    u32 numVertices, u32 delta) {
+    size_t num_saturaciones = (size_t)delta + 1;
+    ColaSaturacion *cola = ArenaAlocar(arena, sizeof(ColaSaturacion));
+    u32 *desde_grado = ArenaAlocarCeros(arena, num_saturaciones + 1,
+                                        sizeof(u32));
+    if (cola == NULL || desde_grado == NULL) return NULL;
+    cola->tamanio = ArenaAlocarCeros(arena, num_saturaciones, sizeof(u32));
+    cola->inicio_bits = ArenaAlocar(arena, num_saturaciones * sizeof(size_t));
+    cola->inicio_resumen = ArenaAlocar(arena,
+                                       num_saturaciones * sizeof(size_t));
+    cola->primer_resumen = ArenaAlocarCeros(arena, num_saturaciones,
+                                            sizeof(size_t));
+    cola->por_grado = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    cola->posicion = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    if (cola->tamanio == NULL || cola->inicio_bits == NULL ||
+        cola->inicio_resumen == NULL || cola->primer_resumen == NULL ||
+        cola->por_grado == NULL ||
+        cola->posicion == NULL) return NULL;
+    // desde_grado[d] termina siendo la cantidad de vértices de grado mayor a
+    // d, que es donde empiezan los de grado d en el orden por grado.
     for (u32 i = 0; i < numVertices; i++) {
-        G->array_vertices[i].infoVertice[Color] = UINT_MAX;
+        desde_grado[grados[i]]++;
     }
-    // Seteamos la cantidad de colores usados en el grafo para volver a
-    // contabilizar en este nuevo coloreo.
-    memset(G->array_cantidad_colores,0,(G->infoGrafo[DeltaGrande]+1)*sizeof
-            (u32));
-
-    // Coloreamos el primer vértice en el orden dado con 0.
-    G->array_vertices[G->array_orden_vertices[0]].infoVertice[Color] = 0;
-    // Aumentamos la cantidad de colores del grafo a 1 y en el arreglo de
-    // colores usados.
-    G->infoGrafo[Colores] = 1;
-    G->array_cantidad_colores[0]++;
-    // Ahora iteramos sobre todos los vértices restantes...
-    // Para cada vértice numero i en el orden de ese momento iteramos sobre los
-    // vecinos j del  mismo...
-    u32 grado_i, color_i, indice_i, color_vecino_j, max_color_vecino;
-    for (u32 i = 1; i < numVertices; i++) {
-        // Variable para contabilizar el máximo color de un vecino.
-        max_color_vecino = 0;
-        // Obtenemos el grado del vértice numero i en el orden dado.
-        grado_i = GradoDelVertice(G, i);
-        // Para cada vecino del vertice...
-        for (u32 j = 0; j < grado_i; j++) {
-            // Obtenemos el color del vecino numero j del vertice número i.
-            color_vecino_j = ColorJotaesimoVecino(G, i, j);
-            // Si fue coloreado entonces...
-            if (color_vecino_j < UINT_MAX) {
-                // Marcamos en el arreglo de colores usados el color del
-                // vecino j como usado.
-                colores_usados[color_vecino_j] = 1;
-                // Verificamos si es el maximoco color de un vecino.
-                if (color_vecino_j >= max_color_vecino) {
-                    max_color_vecino = color_vecino_j;
+    u32 mayores = 0;
+    for (size_t d = num_saturaciones; d-- > 0;) {
+        u32 cantidad = desde_grado[d];
+        desde_grado[d] = mayores;
+        mayores += cantidad;
+    }
+    // Cada saturación s tiene un bit por vértice de grado al menos s, y un
+    // resumen con un bit por palabra no vacía.
+    size_t palabras = 0;
+    size_t palabras_resumen = 0;
+    for (size_t s = 0; s < num_saturaciones; s++) {
+        u32 candidatos = s == 0 ? numVertices : desde_grado[s - 1];
+        size_t palabras_s = ((size_t)candidatos + 63) / 64;
+        cola->inicio_bits[s] = palabras;
+        cola->inicio_resumen[s] = palabras_resumen;
+        palabras += palabras_s;
+        palabras_resumen += (palabras_s + 63) / 64;
+    }
+    cola->bits = ArenaAlocarCeros(arena, palabras + 1, sizeof(uint64_t));
+    cola->resumen = ArenaAlocarCeros(arena, palabras_resumen + 1,
+                                     sizeof(uint64_t));
+    if (cola->bits == NULL || cola->resumen == NULL) return NULL;
+    cola->max_saturacion = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 posicion = desde_grado[grados[i]]++;
+        cola->por_grado[posicion] = i;
+        cola->posicion[i] = posicion;
+        InsertarSaturacion(cola, 0, posicion);
+    }
+    return cola;
+}
+
+/**
+ * @fun: InsertarSaturacion(ColaSaturacion *cola, u32 saturacion,
+ *                          u32 posicion).
+ * @param cola: una cola de saturación.
+ * @param saturacion: saturación del vértice, a lo sumo su grado.
+ * @param posicion: posición del vértice en el orden por grado.
+ * @brief: agrega el vértice al conjunto de su saturación.
+ */
+void InsertarSaturacion(ColaSaturacion *cola, u32 saturacion, u32 posicion) {
+    cola->bits[cola->inicio_bits[saturacion] + posicion / 64] |=
+            (uint64_t)1 << (posicion % 64);
+    cola->resumen[cola->inicio_resumen[saturacion] + posicion / 4096] |=
+            (uint64_t)1 << (posicion / 64 % 64);
+    if (posicion / 4096 < cola->primer_resumen[saturacion]) {
+        cola->primer_resumen[saturacion] = posicion / 4096;
+    }
+    cola->tamanio[saturacion]++;
+    if (saturacion > cola->max_saturacion) cola->max_saturacion = saturacion;
+}
+
+/**
+ * @fun: QuitarSaturacion(ColaSaturacion *cola, u32 saturacion,
+ *                        u32 posicion).
+ * @param cola: una cola de saturación.
+ * @param saturacion: saturación del vértice.
+ * @param posicion: posición del vértice en el orden por grado, que está en
+ * el conjunto de su saturación.
+ * @brief: saca el vértice del conjunto de su saturación.
+ */
+void QuitarSaturacion(ColaSaturacion *cola, u32 saturacion, u32 posicion) {
+    uint64_t *palabra = &cola->bits[cola->inicio_bits[saturacion] +
+                                    posicion / 64];
+    *palabra &= ~((uint64_t)1 << (posicion % 64));
+    if (*palabra == 0) {
+        cola->resumen[cola->inicio_resumen[saturacion] + posicion / 4096] &=
+                ~((uint64_t)1 << (posicion / 64 % 64));
+    }
+    cola->tamanio[saturacion]--;
+}
+
+/**
+ * @fun: ExtraerMasSaturado(ColaSaturacion *cola).
+ * @param cola: una cola de saturación con algún vértice.
+ * @brief: saca de la cola el vértice de mayor saturación y, entre ellos, el
+ * de mayor grado. La mayor saturación sólo baja cuando su conjunto queda
+ * vacío, así que en total baja a lo sumo tantas veces como subió; la
+ * búsqueda en el resumen empieza donde terminó la anterior, salvo que se
+ * haya insertado un vértice antes.
+ * @return: el índice del vértice.
+ */
+u32 ExtraerMasSaturado(ColaSaturacion *cola) {
+    while (cola->tamanio[cola->max_saturacion] == 0) {
+        cola->max_saturacion--;
+    }
+    u32 saturacion = cola->max_saturacion;
+    const uint64_t *resumen = cola->resumen + cola->inicio_resumen[saturacion];
+    size_t r = cola->primer_resumen[saturacion];
+    while (resumen[r] == 0) {
+        r++;
+    }
+    cola->primer_resumen[saturacion] = r;
+    size_t p = r * 64 + (size_t)__builtin_ctzll(resumen[r]);
+    uint64_t palabra = cola->bits[cola->inicio_bits[saturacion] + p];
+    u32 posicion = (u32)(p * 64 + (size_t)__builtin_ctzll(palabra));
+    QuitarSaturacion(cola, saturacion, posicion);
+    return cola->por_grado[posicion];
+}
+
+/**
+ * @fun: PalabrasZonaDsatur(u32 grado).
+ * @param grado: grado de un vértice.
+ * @return: palabras de su zona en Dsatur(): los bits de los colores de
+ * COLORES_MASCARA a su grado, y la cantidad y la lista de los colores
+ * mayores a su grado.
+ */
+size_t PalabrasZonaDsatur(u32 grado) {
+    return grado / COLORES_MASCARA + ((size_t)grado + 2) / 2;
+}
+
+/**
+ * @fun: Dsatur(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: colorea G con DSATUR: en cada paso colorea, con el menor color
+ * libre, el vértice sin color con más colores distintos entre sus vecinos,
+ * y entre ellos el de mayor grado. Cada vértice guarda en bits cuáles de los
+ * colores 0 a su grado ya tiene algún vecino, y en una lista los mayores,
+ * que son raros; así cada lado cuesta O(1) al colorear sus extremos y cada
+ * cambio de saturación cuesta O(1) en la cola. No usa ni cambia el orden de
+ * G. Deja los colores y la cantidad de vértices de cada color en G, como
+ * Greedy().
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 Dsatur(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 delta = G->infoGrafo[DeltaGrande];
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *cantidad = G->array_cantidad_colores;
+    // Palabras de la zona de cada vértice: bits de los colores de
+    // COLORES_MASCARA a su grado, y la lista de colores grandes precedida
+    // por su largo.
+    size_t palabras = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        palabras += PalabrasZonaDsatur(grados[i]);
+    }
+    // Las zonas se ubican con enteros de 32 bits.
+    if (palabras > UINT_MAX) return 0;
+    Arena *arena = ArenaCrear(((size_t)numVertices * 7 + delta) *
+                              sizeof(uint64_t) + palabras *
+                              sizeof(uint64_t), false);
+    if (arena == NULL) return 0;
+    ColaSaturacion *cola = CrearColaSaturacion(arena, grados, numVertices,
+                                               delta);
+    VerticeDsatur *vertices = ArenaAlocar(arena, (size_t)numVertices *
+                                                 sizeof(VerticeDsatur));
+    uint64_t *zonas = ArenaAlocarCeros(arena, palabras + 1,
+                                       sizeof(uint64_t));
+    if (cola == NULL || vertices == NULL || zonas == NULL) {
+        ArenaDestruir(arena);
+        return 0;
+    }
+    palabras = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        vertices[i].vistos = 0;
+        vertices[i].saturacion = 0;
+        vertices[i].grado = grados[i];
+        vertices[i].posicion = cola->posicion[i];
+        vertices[i].zona = (u32)palabras;
+        palabras += PalabrasZonaDsatur(grados[i]);
+    }
+
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    for (u32 k = 0; k < numVertices; k++) {
+        u32 indice_v = ExtraerMasSaturado(cola);
+        VerticeDsatur *v = &vertices[indice_v];
+        // Algún color de 0 al grado está libre, porque hay a lo sumo grado
+        // vecinos; los bits de relleno de la última palabra no se alcanzan.
+        u32 color_v;
+        if (v->vistos != UINT64_MAX) {
+            color_v = (u32)__builtin_ctzll(~v->vistos);
+        } else {
+            const uint64_t *vistos_v = zonas + v->zona;
+            u32 w = 0;
+            while (vistos_v[w] == UINT64_MAX) {
+                w++;
+            }
+            color_v = (w + 1) * COLORES_MASCARA +
+                      (u32)__builtin_ctzll(~vistos_v[w]);
+        }
+        colores[indice_v] = color_v;
+        cantidad[color_v]++;
+        if (color_v + 1 > num_colores) num_colores = color_v + 1;
+        // Los vecinos sin color que no tenían este color entre sus vecinos
+        // suben una saturación. Los colores están juntos en un arreglo más
+        // chico, así que los vecinos coloreados se descartan sin traer su
+        // estructura a la caché.
+        const u32 *vecinos_v = VecinosEnCache(G, indice_v);
+        for (u32 j = 0; j < v->grado; j++) {
+            u32 indice_u = vecinos_v[j];
+            if (colores[indice_u] != UINT_MAX) continue;
+            VerticeDsatur *u = &vertices[indice_u];
+            uint64_t *palabra;
+            if (color_v < COLORES_MASCARA) {
+                palabra = &u->vistos;
+            } else if (color_v <= u->grado) {
+                palabra = zonas + u->zona + color_v / COLORES_MASCARA - 1;
+            } else {
+                palabra = NULL;
+            }
+            bool nuevo;
+            if (palabra != NULL) {
+                uint64_t bit = (uint64_t)1 << (color_v % COLORES_MASCARA);
+                nuevo = (*palabra & bit) == 0;
+                *palabra |= bit;
+            } else {
+                u32 *grandes_u = (u32 *)(zonas + u->zona +
+                                         u->grado / COLORES_MASCARA);
+                u32 l = 1;
+                while (l <= grandes_u[0] && grandes_u[l] != color_v) {
+                    l++;
                 }
+                nuevo = l > grandes_u[0];
+                if (nuevo) grandes_u[++grandes_u[0]] = color_v;
+            }
+            if (nuevo) {
+                QuitarSaturacion(cola, u->saturacion, u->posicion);
+                InsertarSaturacion(cola, ++u->saturacion, u->posicion);
             }
         }
-        // Ahora vemos el color que tendrá el vértice i..
-        color_i = 0;
-        // Iteramos sobre el arreglo de colores usados. Si el color en la
-        // posiicion i fue usado seguimos buscando en la posicion inmediata.
-        // Si encontramos un color que no fue usado salimos del ciclo.
-        while (colores_usados[color_i] == 1) {
-            color_i++;
+    }
+    G->infoGrafo[Colores] = num_colores;
+    ArenaDestruir(arena);
+    return num_colores;
+}
+
+/**
+ * @fun: CrearRestoRlf(struct _Arena_ *arena, Grafo G).
+ * @param arena: arena de la que salen los arreglos del resto.
+ * @param G: un grafo correctamente construido.
+ * @return: el subgrafo de todos los vértices de G, con sus vecinos copiados
+ * de G; NULL si no hubo memoria.
+ */
+RestoRlf *CrearRestoRlf(struct _Arena_ *arena, Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *grados = G->infoVertices[Grado];
+    size_t extremos = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        extremos += grados[i];
+    }
+    // Los vecinos se ubican con enteros de 32 bits, como en G.
+    if (extremos > UINT_MAX) return NULL;
+    RestoRlf *resto = ArenaAlocar(arena, sizeof(RestoRlf));
+    if (resto == NULL) return NULL;
+    resto->original = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    resto->inicio = ArenaAlocar(arena, ((size_t)numVertices + 1) *
+                                       sizeof(u32));
+    resto->grados = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    resto->vecinos = ArenaAlocar(arena, (extremos + 1) * sizeof(u32));
+    if (resto->original == NULL || resto->inicio == NULL ||
+        resto->grados == NULL || resto->vecinos == NULL) return NULL;
+    resto->num_vertices = numVertices;
+    resto->delta = G->infoGrafo[DeltaGrande];
+    u32 copiados = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        resto->original[i] = i;
+        resto->inicio[i] = copiados;
+        resto->grados[i] = grados[i];
+        memcpy(resto->vecinos + copiados, VecinosEnCache(G, i),
+               (size_t)grados[i] * sizeof(u32));
+        copiados += grados[i];
+    }
+    resto->inicio[numVertices] = copiados;
+    return resto;
+}
+
+/**
+ * @fun: CompactarRestoRlf(RestoRlf *resto, VerticeRlf vertices[]).
+ * @param resto: el resto con el que se armó una clase.
+ * @param vertices: los datos de la clase, con RLF_EN_CLASE en los vértices
+ * de la clase.
+ * @brief: saca del resto los vértices de la clase y los lados que los tocan,
+ * moviendo los arreglos en el lugar, y recalcula el grado máximo. Usa la
+ * posición de vertices para guardar los índices nuevos.
+ */
+void CompactarRestoRlf(RestoRlf *resto, VerticeRlf vertices[]) {
+    u32 numVertices = resto->num_vertices;
+    u32 quedan = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        if (vertices[i].excluidos != RLF_EN_CLASE) {
+            vertices[i].posicion = quedan++;
+        }
+    }
+    // Cada vértice y sus vecinos se escriben en un lugar anterior o igual al
+    // que se lee, así que se puede hacer en el lugar; sólo hay que leer el
+    // fin de los vecinos de i antes de que se pise.
+    u32 *inicio = resto->inicio;
+    u32 *vecinos = resto->vecinos;
+    u32 escritos = 0;
+    u32 nuevo = 0;
+    u32 delta = 0;
+    u32 desde = inicio[0];
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 hasta = inicio[i + 1];
+        if (vertices[i].excluidos != RLF_EN_CLASE) {
+            u32 primero = escritos;
+            for (u32 p = desde; p < hasta; p++) {
+                const VerticeRlf *u = &vertices[vecinos[p]];
+                if (u->excluidos != RLF_EN_CLASE) {
+                    vecinos[escritos++] = u->posicion;
+                }
+            }
+            resto->original[nuevo] = resto->original[i];
+            resto->grados[nuevo] = escritos - primero;
+            if (escritos - primero > delta) delta = escritos - primero;
+            inicio[++nuevo] = escritos;
+        }
+        desde = hasta;
+    }
+    resto->num_vertices = quedan;
+    resto->delta = delta;
+}
+
+/**
+ * @fun: ElegirCandidatoRlf(u32 lista[], u32 *num_lista,
+ *                          const VerticeRlf vertices[], const u32 grados[]).
+ * @param lista: los vértices que pueden entrar en la clase, en orden de
+ * índice, y quizás algunos que ya no pueden.
+ * @param num_lista: largo de la lista.
+ * @param vertices: los datos de la clase.
+ * @param grados: grado de cada vértice en el resto.
+ * @brief: saca de la lista los vértices que ya no pueden entrar, sin cambiar
+ * el orden de los demás, y elige como la cola de ColorearClaseRlf(): el de
+ * más vecinos excluidos, entre ellos el de mayor grado y después el de
+ * menor índice.
+ * @return: el vértice elegido, que sigue en la lista.
+ */
+u32 ElegirCandidatoRlf(u32 lista[], u32 *num_lista,
+                       const VerticeRlf vertices[], const u32 grados[]) {
+    u32 quedan = 0;
+    u32 elegido = UINT_MAX;
+    u32 max_excluidos = 0;
+    u32 max_grado = 0;
+    for (u32 k = 0; k < *num_lista; k++) {
+        u32 u = lista[k];
+        u32 excluidos = vertices[u].excluidos;
+        if (excluidos >= RLF_EXCLUIDO) continue;
+        lista[quedan++] = u;
+        if (elegido == UINT_MAX || excluidos > max_excluidos ||
+            (excluidos == max_excluidos && grados[u] > max_grado)) {
+            elegido = u;
+            max_excluidos = excluidos;
+            max_grado = grados[u];
+        }
+    }
+    *num_lista = quedan;
+    return elegido;
+}
+
+/**
+ * @fun: ColorearClaseRlf(RestoRlf *resto, u32 color, u32 colores[]).
+ * @param resto: el subgrafo de los vértices sin color, con alguno.
+ * @param color: color de la clase.
+ * @param colores: colores de los vértices del grafo.
+ * @brief: arma una clase de color con los vértices del resto. Empieza por
+ * el de mayor grado en el resto y agrega cada vez el vértice que todavía
+ * puede entrar con más vecinos excluidos de la clase; entre ellos, el de
+ * mayor grado en el resto, y después el de menor índice. Los vértices se
+ * eligen con la cola de saturación de Dsatur(), usando como saturación la
+ * cantidad de vecinos excluidos, que no pasa del grado. Al excluir un
+ * vértice se suma uno a sus vecinos que pueden entrar, así que cada lado
+ * del resto se recorre a lo sumo dos veces. Al final saca la clase del
+ * resto con CompactarRestoRlf().
+ * @return: la cantidad de vértices de la clase; 0 si no hubo memoria.
+ */
+u32 ColorearClaseRlf(RestoRlf *resto, u32 color, u32 colores[]) {
+    u32 numVertices = resto->num_vertices;
+    const u32 *inicio = resto->inicio;
+    const u32 *vecinos = resto->vecinos;
+    // Con pocos candidatos por grado es más barato buscar en la lista que
+    // mantener la cola: elegir cuesta un recorrido de la lista, y la cola
+    // cuesta cada vez que un vecino excluido suma.
+    size_t promedio = inicio[numVertices] / numVertices + 1;
+    size_t umbral = RLF_FACTOR_LISTA * promedio * promedio;
+    // La cola ocupa un bit por extremo de cada lado y por vértice, más unas
+    // palabras por grado.
+    Arena *arena = ArenaCrear(((size_t)numVertices * 3 +
+                               (size_t)resto->delta * 6) * sizeof(uint64_t) +
+                              ((size_t)inicio[numVertices] + numVertices) / 8,
+                              false);
+    if (arena == NULL) return 0;
+    VerticeRlf *vertices = ArenaAlocar(arena, (size_t)numVertices *
+                                              sizeof(VerticeRlf));
+    u32 *lista = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    ColaSaturacion *cola = NULL;
+    if (numVertices > umbral && vertices != NULL) {
+        cola = CrearColaSaturacion(arena, resto->grados, numVertices,
+                                   resto->delta);
+        if (cola == NULL) vertices = NULL;
+    }
+    if (vertices == NULL || lista == NULL) {
+        ArenaDestruir(arena);
+        return 0;
+    }
+    for (u32 i = 0; i < numVertices; i++) {
+        vertices[i].excluidos = 0;
+        vertices[i].posicion = cola != NULL ? cola->posicion[i] : 0;
+        lista[i] = i;
+    }
+    // Vértices que todavía pueden entrar en la clase, y largo de la lista,
+    // que puede tener algunos que ya no.
+    u32 candidatos = numVertices;
+    u32 en_lista = numVertices;
+    u32 tamanio = 0;
+    while (candidatos > 0) {
+        u32 v;
+        if (cola != NULL && candidatos <= umbral) {
+            // Se deja la cola y se sigue con la lista de candidatos, que
+            // queda en orden de índice.
+            en_lista = 0;
+            for (u32 i = 0; i < numVertices; i++) {
+                if (vertices[i].excluidos < RLF_EXCLUIDO) {
+                    lista[en_lista++] = i;
+                }
+            }
+            cola = NULL;
+        }
+        if (cola != NULL) {
+            v = ExtraerMasSaturado(cola);
+        } else {
+            v = ElegirCandidatoRlf(lista, &en_lista, vertices,
+                                   resto->grados);
+        }
+        vertices[v].excluidos = RLF_EN_CLASE;
+        colores[resto->original[v]] = color;
+        candidatos--;
+        tamanio++;
+        // Los vecinos de v que podían entrar quedan excluidos, y cada uno le
+        // suma un vecino excluido a sus vecinos que todavía pueden entrar.
+        for (u32 p = inicio[v]; p < inicio[v + 1]; p++) {
+            u32 indice_w = vecinos[p];
+            VerticeRlf *w = &vertices[indice_w];
+            if (w->excluidos >= RLF_EXCLUIDO) continue;
+            if (cola != NULL) {
+                QuitarSaturacion(cola, w->excluidos, w->posicion);
+            }
+            w->excluidos = RLF_EXCLUIDO;
+            candidatos--;
+            if (cola != NULL) {
+                for (u32 q = inicio[indice_w]; q < inicio[indice_w + 1];
+                     q++) {
+                    VerticeRlf *x = &vertices[vecinos[q]];
+                    if (x->excluidos >= RLF_EXCLUIDO) continue;
+                    QuitarSaturacion(cola, x->excluidos, x->posicion);
+                    InsertarSaturacion(cola, ++x->excluidos, x->posicion);
+                }
+            } else {
+                // Sin cola basta con contar, y las marcas no se tocan.
+                for (u32 q = inicio[indice_w]; q < inicio[indice_w + 1];
+                     q++) {
+                    VerticeRlf *x = &vertices[vecinos[q]];
+                    x->excluidos += x->excluidos < RLF_EXCLUIDO;
+                }
+            }
         }
-        // Al llegar aquí tenemos el color del vértice i, así que se lo
-        // asignamos y además contabilizamos este color en el arreglo de
-        // cantidad de colores del grafo...
-        indice_i = G->array_orden_vertices[i];
-        G->array_vertices[indice_i].infoVertice[Color] = color_i;
-        G->array_cantidad_colores[color_i]++;
-        // Si el color que acaba de tomar el vértice i + 1 (pues al ser el
-        // cero un color debe sumarse 1 para contar la cantidad e colores) es
-        // mayor a la cantidad de colores que tenía el grafo entonces
-        // aumentamos la cantidad de colores del grafo.
-        if ((color_i+1) > G->infoGrafo[Colores]) {
-            G->infoGrafo[Colores] = (color_i+1);
-        }
-        // Luego seteamos el arreglo de colores usados para el próximo
-        // vértice; seteamos solo las posiciones que fueron usadas...
-        memset(colores_usados,0,max_color_vecino+1);
-    }
-    // Finalmente liberamos memoria...
-    free(colores_usados);
-    // Y devolvemos el número de colores que se obtuvo...
-    return NumeroDeColores(G);
+    }
+    CompactarRestoRlf(resto, vertices);
+    ArenaDestruir(arena);
+    return tamanio;
+}
+
+/**
+ * @fun: Rlf(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: colorea G con Recursive Largest First: arma una clase de color por
+ * vez con ColorearClaseRlf() entre los vértices que quedan sin color. Cada
+ * clase cuesta O(vértices + lados) del resto, que se achica clase a clase,
+ * así que en total cuesta a lo sumo O((n + m) * colores). Cada clase es un
+ * conjunto independiente maximal del resto, así que usa a lo sumo delta
+ * grande + 1 colores. No usa ni cambia el orden de G. Deja los colores y la
+ * cantidad de vértices de cada color en G, como Greedy().
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 Rlf(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    Arena *arena = ArenaCrear(((size_t)numVertices * 3 + 1) * sizeof(u32) +
+                              (size_t)G->infoGrafo[Lados] * 2 * sizeof(u32),
+                              false);
+    if (arena == NULL) return 0;
+    RestoRlf *resto = CrearRestoRlf(arena, G);
+    if (resto == NULL) {
+        ArenaDestruir(arena);
+        return 0;
+    }
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    while (resto->num_vertices > 0) {
+        u32 tamanio = ColorearClaseRlf(resto, num_colores,
+                                       G->infoVertices[Color]);
+        if (tamanio == 0) {
+            ArenaDestruir(arena);
+            return 0;
+        }
+        G->array_cantidad_colores[num_colores++] = tamanio;
+    }
+    G->infoGrafo[Colores] = num_colores;
+    ArenaDestruir(arena);
+    return num_colores;
 }
@@ -0,0 +1,339 @@
+/**
+ * @file: Coloreo.h
+ * @brief: Fichero con las funciones auxiliares de Coloreo.c
+ */
+
+#ifndef COLOREO_H
+#define COLOREO_H
+
+#include <stdint.h>
+
+#include "Espacio.h"
+#include "Rii.h"
+
+// Greedy usa a lo sumo delta grande + 1 colores, así que si delta grande es
+// menor a COLORES_MASCARA los colores prohibidos de un vértice entran en una
+// palabra de 64 bits, y si es menor a COLORES_MASCARAS en PALABRAS_MASCARAS
+// palabras.
+#define COLORES_MASCARA 64
+#define PALABRAS_MASCARAS 4
+#define COLORES_MASCARAS (PALABRAS_MASCARAS * COLORES_MASCARA)
+
+/**
+ * @fun: PrepararGreedy(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: deja a todos los vértices sin color y la cantidad de vértices de
+ * cada color en cero, antes de colorear con Greedy.
+ */
+void PrepararGreedy(Grafo G);
+
+/**
+ * @fun: GreedyConMarcas(Grafo G, u32 marcas[], u32 *generacion).
+ * @param G: un grafo correctamente construido.
+ * @param marcas: arreglo de delta grande + 1 elementos; marcas[c] es la
+ * generación en la que el color c se vio por última vez en un vecino.
+ * @param generacion: última generación usada con marcas; se incrementa una
+ * vez por vértice.
+ * @brief: colorea G con Greedy en el orden dado. Cada vértice usa una
+ * generación nueva, así que los colores prohibidos del vértice anterior
+ * quedan descartados sin limpiar el arreglo; sólo se limpia cuando la
+ * generación da la vuelta. Lee los arreglos internos del grafo
+ * directamente.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMarcas(Grafo G, u32 marcas[], u32 *generacion);
+
+/**
+ * @fun: MascaraVecinos(const u32 colores[], const u32 vecinos[], u32 grado).
+ * @param colores: color de cada vértice, menor a COLORES_MASCARA o UINT_MAX.
+ * @param vecinos: índices de los vecinos de un vértice.
+ * @param grado: cantidad de vecinos.
+ * @return: palabra con el bit c prendido si algún vecino tiene color c.
+ */
+uint64_t MascaraVecinos(const u32 colores[], const u32 vecinos[], u32 grado);
+
+/**
+ * @fun: MascarasVecinos(const u32 colores[], const u32 vecinos[], u32 grado,
+ *                       uint64_t prohibidos[]).
+ * @param colores: color de cada vértice, menor a COLORES_MASCARAS o
+ * UINT_MAX.
+ * @param vecinos: índices de los vecinos de un vértice.
+ * @param grado: cantidad de vecinos.
+ * @param prohibidos: PALABRAS_MASCARAS palabras donde se prenden los bits de
+ * los colores de los vecinos, sin borrar los que ya estaban.
+ */
+void MascarasVecinos(const u32 colores[], const u32 vecinos[], u32 grado,
+                     uint64_t prohibidos[]);
+
+/**
+ * @fun: PrimerColorLibre(const uint64_t prohibidos[]).
+ * @param prohibidos: PALABRAS_MASCARAS palabras de colores prohibidos, con
+ * algún bit libre.
+ * @return: el menor color cuyo bit no está prendido.
+ */
+u32 PrimerColorLibre(const uint64_t prohibidos[]);
+
+/**
+ * @fun: GreedyConMascara(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARA.
+ * @brief: colorea G con Greedy en el orden dado, juntando los colores
+ * prohibidos de cada vértice en los bits de una palabra, sin ramas, y
+ * eligiendo el primer bit libre con una sola instrucción.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMascara(Grafo G);
+
+/**
+ * @fun: GreedyConMascaras(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARAS.
+ * @brief: como GreedyConMascara(), con PALABRAS_MASCARAS palabras de colores
+ * prohibidos; se busca el primer bit libre palabra por palabra.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMascaras(Grafo G);
+
+/**
+ * @fun: GreedyConEspacio(Grafo G, Espacio E).
+ * @param G: un grafo correctamente construido.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: si delta grande es chico usa GreedyConMascara() o
+ * GreedyConMascaras(), que no necesitan E; si no, GreedyConMarcas() con las
+ * marcas de E. Si el procesador lo permite y el grafo tiene suficientes
+ * vecinos por vértice, usa sus versiones vectoriales. En ningún caso aloca
+ * memoria.
+ * @return: el número de colores obtenido; 0 si hace falta E y no alcanza
+ * para G.
+ */
+u32 GreedyConEspacio(Grafo G, Espacio E);
+
+/**
+ * @fun: BipartitoConEspacio(Grafo G, Espacio E).
+ * @param G: un grafo correctamente construido.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como Bipartito(), usando la cola de E para el BFS y E para
+ * colorear con Greedy si G no es bipartito.
+ * @return: devuelve 1 si G es bipartito, 0 si no o si E no alcanza para G.
+ */
+int BipartitoConEspacio(Grafo G, Espacio E);
+
+// Cola de prioridad de DSATUR. Los vértices se numeran por su posición en
+// el orden por grado decreciente, y para cada saturación hay un conjunto de
+// bits de esas posiciones con un resumen de un bit por palabra no vacía; el
+// primer bit prendido de la mayor saturación es el vértice a colorear.
+typedef struct _ColaSaturacion_ {
+    // Mayor saturación que puede tener vértices; baja perezosamente.
+    u32 max_saturacion;
+    // Cantidad de vértices con cada saturación.
+    u32 *tamanio;
+    // Bits de todas las saturaciones y dónde empiezan los de cada una.
+    uint64_t *bits;
+    size_t *inicio_bits;
+    // Resúmenes de todas las saturaciones, dónde empieza el de cada una y
+    // su primera palabra que puede no estar vacía.
+    uint64_t *resumen;
+    size_t *inicio_resumen;
+    size_t *primer_resumen;
+    // Vértice en cada posición del orden por grado, y posición de cada
+    // vértice.
+    u32 *por_grado;
+    u32 *posicion;
+} ColaSaturacion;
+
+// Datos de cada vértice que DSATUR consulta al colorear un vecino, juntos
+// para traerlos a la caché de una vez.
+typedef struct _VerticeDsatur_ {
+    // Bits de los colores menores a COLORES_MASCARA que tiene algún vecino.
+    uint64_t vistos;
+    // Cantidad de colores distintos entre sus vecinos.
+    u32 saturacion;
+    u32 grado;
+    // Posición en el orden por grado de la cola.
+    u32 posicion;
+    // Palabra donde empieza su zona: un bit por cada color de
+    // COLORES_MASCARA a su grado que tiene algún vecino, y luego la cantidad
+    // y la lista de los colores mayores a su grado que tiene algún vecino.
+    u32 zona;
+} VerticeDsatur;
+
+/**
+ * @fun: CrearColaSaturacion(struct _Arena_ *arena, const u32 grados[],
+ *                           u32 numVertices, u32 delta).
+ * @param arena: arena de la que salen los arreglos de la cola.
+ * @param grados: grado de cada vértice.
+ * @param numVertices: cantidad de vértices.
+ * @param delta: grado máximo.
+ * @brief: ordena los vértices por grado decreciente, y entre los de igual
+ * grado por índice, y crea una cola con todos en saturación 0. Como un
+ * vértice de grado d nunca pasa de saturación d, el conjunto de la
+ * saturación s sólo necesita un bit por cada vértice de grado al menos s:
+ * entre todas las saturaciones, 2 * lados + vértices bits.
+ * @return: la cola; NULL si no hubo memoria.
+ */
+ColaSaturacion *CrearColaSaturacion(struct _Arena_ *arena, const u32 grados[],
+                                    u32 numVertices, u32 delta);
+
+/**
+ * @fun: InsertarSaturacion(ColaSaturacion *cola, u32 saturacion,
+ *                          u32 posicion).
+ * @param cola: una cola de saturación.
+ * @param saturacion: saturación del vértice, a lo sumo su grado.
+ * @param posicion: posición del vértice en el orden por grado.
+ * @brief: agrega el vértice al conjunto de su saturación.
+ */
+void InsertarSaturacion(ColaSaturacion *cola, u32 saturacion, u32 posicion);
+
+/**
+ * @fun: QuitarSaturacion(ColaSaturacion *cola, u32 saturacion,
+ *                        u32 posicion).
+ * @param cola: una cola de saturación.
+ * @param saturacion: saturación del vértice.
+ * @param posicion: posición del vértice en el orden por grado, que está en
+ * el conjunto de su saturación.
+ * @brief: saca el vértice del conjunto de su saturación.
+ */
+void QuitarSaturacion(ColaSaturacion *cola, u32 saturacion, u32 posicion);
+
+/**
+ * @fun: ExtraerMasSaturado(ColaSaturacion *cola).
+ * @param cola: una cola de saturación con algún vértice.
+ * @brief: saca de la cola el vértice de mayor saturación y, entre ellos, el
+ * de mayor grado. La mayor saturación sólo baja cuando su conjunto queda
+ * vacío, así que en total baja a lo sumo tantas veces como subió; la
+ * búsqueda en el resumen empieza donde terminó la anterior, salvo que se
+ * haya insertado un vértice antes.
+ * @return: el índice del vértice.
+ */
+u32 ExtraerMasSaturado(ColaSaturacion *cola);
+
+/**
+ * @fun: PalabrasZonaDsatur(u32 grado).
+ * @param grado: grado de un vértice.
+ * @return: palabras de su zona en Dsatur(): los bits de los colores de
+ * COLORES_MASCARA a su grado, y la cantidad y la lista de los colores
+ * mayores a su grado.
+ */
+size_t PalabrasZonaDsatur(u32 grado);
+
+/**
+ * @fun: Dsatur(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: colorea G con DSATUR: en cada paso colorea, con el menor color
+ * libre, el vértice sin color con más colores distintos entre sus vecinos,
+ * y entre ellos el de mayor grado. Cada vértice guarda en bits cuáles de los
+ * colores 0 a su grado ya tiene algún vecino, y en una lista los mayores,
+ * que son raros; así cada lado cuesta O(1) al colorear sus extremos y cada
+ * cambio de saturación cuesta O(1) en la cola. No usa ni cambia el orden de
+ * G. Deja los colores y la cantidad de vértices de cada color en G, como
+ * Greedy().
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 Dsatur(Grafo G);
+
+// Marcas de Rlf() en el campo excluidos de los vértices que ya no pueden
+// entrar en la clase que se arma: los de la clase y sus vecinos.
+#define RLF_EN_CLASE UINT_MAX
+#define RLF_EXCLUIDO (UINT_MAX - 1)
+
+// Rlf() elige los vértices de una clase con la cola de saturación mientras
+// haya más de RLF_FACTOR_LISTA * (grado promedio + 1)^2 candidatos, y con
+// menos los busca en una lista.
+#define RLF_FACTOR_LISTA 4
+
+// Subgrafo de los vértices que le faltan colorear a Rlf(). Los vértices se
+// renumeran de 0 en adelante respetando el orden de sus índices en el grafo,
+// y después de cada clase se sacan los coloreados, así que cada clase sólo
+// recorre los lados que quedan.
+typedef struct _RestoRlf_ {
+    u32 num_vertices;
+    u32 delta;
+    // Índice en el grafo de cada vértice.
+    u32 *original;
+    // Los vecinos del vértice i están en vecinos desde inicio[i] hasta
+    // inicio[i + 1], sin incluirlo.
+    u32 *inicio;
+    u32 *vecinos;
+    u32 *grados;
+} RestoRlf;
+
+// Datos de cada vértice del resto mientras Rlf() arma una clase.
+typedef struct _VerticeRlf_ {
+    // Cantidad de vecinos excluidos de la clase, o RLF_EXCLUIDO o
+    // RLF_EN_CLASE si el vértice ya no puede entrar.
+    u32 excluidos;
+    // Posición en el orden por grado de la cola; al compactar, su índice en
+    // el resto siguiente.
+    u32 posicion;
+} VerticeRlf;
+
+/**
+ * @fun: CrearRestoRlf(struct _Arena_ *arena, Grafo G).
+ * @param arena: arena de la que salen los arreglos del resto.
+ * @param G: un grafo correctamente construido.
+ * @return: el subgrafo de todos los vértices de G, con sus vecinos copiados
+ * de G; NULL si no hubo memoria.
+ */
+RestoRlf *CrearRestoRlf(struct _Arena_ *arena, Grafo G);
+
+/**
+ * @fun: CompactarRestoRlf(RestoRlf *resto, VerticeRlf vertices[]).
+ * @param resto: el resto con el que se armó una clase.
+ * @param vertices: los datos de la clase, con RLF_EN_CLASE en los vértices
+ * de la clase.
+ * @brief: saca del resto los vértices de la clase y los lados que los tocan,
+ * moviendo los arreglos en el lugar, y recalcula el grado máximo. Usa la
+ * posición de vertices para guardar los índices nuevos.
+ */
+void CompactarRestoRlf(RestoRlf *resto, VerticeRlf vertices[]);
+
+/**
+ * @fun: ElegirCandidatoRlf(u32 lista[], u32 *num_lista,
+ *                          const VerticeRlf vertices[], const u32 grados[]).
+ * @param lista: los vértices que pueden entrar en la clase, en orden de
+ * índice, y quizás algunos que ya no pueden.
+ * @param num_lista: largo de la lista.
+ * @param vertices: los datos de la clase.
+ * @param grados: grado de cada vértice en el resto.
+ * @brief: saca de la lista los vértices que ya no pueden entrar, sin cambiar
+ * el orden de los demás, y elige como la cola de ColorearClaseRlf(): el de
+ * más vecinos excluidos, entre ellos el de mayor grado y después el de
+ * menor índice.
+ * @return: el vértice elegido, que sigue en la lista.
+ */
+u32 ElegirCandidatoRlf(u32 lista[], u32 *num_lista,
+                       const VerticeRlf vertices[], const u32 grados[]);
+
+/**
+ * @fun: ColorearClaseRlf(RestoRlf *resto, u32 color, u32 colores[]).
+ * @param resto: el subgrafo de los vértices sin color, con alguno.
+ * @param color: color de la clase.
+ * @param colores: colores de los vértices del grafo.
+ * @brief: arma una clase de color con los vértices del resto. Empieza por
+ * el de mayor grado en el resto y agrega cada vez el vértice que todavía
+ * puede entrar con más vecinos excluidos de la clase; entre ellos, el de
+ * mayor grado en el resto, y después el de menor índice. Los vértices se
+ * eligen con la cola de saturación de Dsatur(), usando como saturación la
+ * cantidad de vecinos excluidos, que no pasa del grado. Al excluir un
+ * vértice se suma uno a sus vecinos que pueden entrar, así que cada lado
+ * del resto se recorre a lo sumo dos veces. Al final saca la clase del
+ * resto con CompactarRestoRlf().
+ * @return: la cantidad de vértices de la clase; 0 si no hubo memoria.
+ */
+u32 ColorearClaseRlf(RestoRlf *resto, u32 color, u32 colores[]);
+
+/**
+ * @fun: Rlf(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: colorea G con Recursive Largest First: arma una clase de color por
+ * vez con ColorearClaseRlf() entre los vértices que quedan sin color. Cada
+ * clase cuesta O(vértices + lados) del resto, que se achica clase a clase,
+ * así que en total cuesta a lo sumo O((n + m) * colores). Cada clase es un
+ * conjunto independiente maximal del resto, así que usa a lo sumo delta
+ * grande + 1 colores. No usa ni cambia el orden de G. Deja los colores y la
+ * cantidad de vértices de cada color en G, como Greedy().
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 Rlf(Grafo G);
+
+#endif // COLOREO_H
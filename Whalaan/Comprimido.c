@@ -0,0 +1,264 @@
+/**
+ * @file: Comprimido.c
+ * @brief: implementación de las funciones para guardar los vecinos del
+ * grafo comprimidos y leerlos.
+ */
+
+#include "Comprimido.h"
+#include "Construye.h"
+
+/**
+ * @fun: ZigZag(u32 vertice, u32 vecino).
+ * @param vertice: índice de un vértice.
+ * @param vecino: índice de su primer vecino.
+ * @return: la diferencia vecino - vertice, con signo, llevada a un entero
+ * sin signo de forma que las diferencias chicas den números chicos.
+ */
+u32 ZigZag(u32 vertice, u32 vecino) {
+    u32 diferencia = vecino - vertice;
+    // El bit de signo pasa a ser el bit más bajo.
+    return (diferencia << 1) ^ (0u - (diferencia >> 31));
+}
+
+/**
+ * @fun: DesZigZag(u32 vertice, u32 codigo).
+ * @param vertice: índice de un vértice.
+ * @param codigo: resultado de ZigZag(vertice, vecino).
+ * @return: el índice vecino.
+ */
+u32 DesZigZag(u32 vertice, u32 codigo) {
+    return vertice + ((codigo >> 1) ^ (0u - (codigo & 1)));
+}
+
+/**
+ * @fun: TamanioVarint(u32 valor).
+ * @param valor: un entero.
+ * @return: la cantidad de bytes que ocupa valor codificado.
+ */
+size_t TamanioVarint(u32 valor) {
+    size_t bytes = 1;
+    while (valor >= 0x80) {
+        valor >>= 7;
+        bytes++;
+    }
+    return bytes;
+}
+
+/**
+ * @fun: EscribirVarint(unsigned char *destino, u32 valor).
+ * @param destino: lugar donde escribir.
+ * @param valor: entero a codificar.
+ * @return: la posición siguiente al último byte escrito.
+ */
+unsigned char *EscribirVarint(unsigned char *destino, u32 valor) {
+    while (valor >= 0x80) {
+        *destino++ = (unsigned char)(valor | 0x80);
+        valor >>= 7;
+    }
+    *destino++ = (unsigned char)valor;
+    return destino;
+}
+
+/**
+ * @fun: LeerVarint(const unsigned char *origen, u32 *valor).
+ * @param origen: comienzo de un entero codificado.
+ * @param valor: lugar donde guardar el entero.
+ * @return: la posición siguiente al último byte leído.
+ */
+const unsigned char *LeerVarint(const unsigned char *origen, u32 *valor) {
+    u32 resultado = 0;
+    u32 desplazamiento = 0;
+    unsigned char byte;
+    do {
+        byte = *origen++;
+        resultado |= (u32)(byte & 0x7F) << desplazamiento;
+        desplazamiento += 7;
+    } while (byte & 0x80);
+    *valor = resultado;
+    return origen;
+}
+
+/**
+ * @fun: TamanioVecinosComprimidos(u32 vertice, const u32 vecinos[],
+ *                                 u32 grado).
+ * @param vertice: índice de un vértice.
+ * @param vecinos: sus vecinos, de menor a mayor.
+ * @param grado: su grado.
+ * @return: la cantidad de bytes que ocupan sus vecinos comprimidos.
+ */
+size_t TamanioVecinosComprimidos(u32 vertice, const u32 vecinos[], u32 grado) {
+    if (grado == 0) return 0;
+    size_t bytes = TamanioVarint(ZigZag(vertice, vecinos[0]));
+    for (u32 j = 1; j < grado; j++) {
+        bytes += TamanioVarint(vecinos[j] - vecinos[j - 1] - 1);
+    }
+    return bytes;
+}
+
+/**
+ * @fun: CodificarVecinos(unsigned char *destino, u32 vertice,
+ *                        const u32 vecinos[], u32 grado).
+ * @param destino: lugar donde escribir.
+ * @param vertice: índice de un vértice.
+ * @param vecinos: sus vecinos, de menor a mayor y sin repetir.
+ * @param grado: su grado.
+ * @return: la posición siguiente al último byte escrito.
+ */
+unsigned char *CodificarVecinos(unsigned char *destino, u32 vertice,
+                                const u32 vecinos[], u32 grado) {
+    if (grado == 0) return destino;
+    destino = EscribirVarint(destino, ZigZag(vertice, vecinos[0]));
+    // Como los vecinos no se repiten, la diferencia es al menos 1 y se
+    // guarda restándole 1.
+    for (u32 j = 1; j < grado; j++) {
+        destino = EscribirVarint(destino, vecinos[j] - vecinos[j - 1] - 1);
+    }
+    return destino;
+}
+
+/**
+ * @fun: DecodificarVecinos(const unsigned char *origen, u32 vertice,
+ *                          u32 grado, u32 destino[]).
+ * @param origen: comienzo de los vecinos comprimidos de un vértice.
+ * @param vertice: índice del vértice.
+ * @param grado: su grado.
+ * @param destino: arreglo de al menos grado elementos donde escribir los
+ * índices de sus vecinos.
+ * @brief: decodifica los vecinos de un vértice. Las diferencias de un byte,
+ * que son la gran mayoría, se leen sin entrar al ciclo general.
+ */
+void DecodificarVecinos(const unsigned char *origen, u32 vertice, u32 grado,
+                        u32 destino[]) {
+    if (grado == 0) return;
+    u32 codigo;
+    origen = LeerVarint(origen, &codigo);
+    u32 actual = DesZigZag(vertice, codigo);
+    destino[0] = actual;
+    for (u32 j = 1; j < grado; j++) {
+        u32 diferencia = *origen;
+        if (diferencia < 0x80) {
+            origen++;
+        } else {
+            origen = LeerVarint(origen, &diferencia);
+        }
+        actual += diferencia + 1;
+        destino[j] = actual;
+    }
+}
+
+/**
+ * @fun: EstaComprimido(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @return: true si la topología del grafo está comprimida; false si no.
+ */
+bool EstaComprimido(Grafo G) {
+    return G->topologia != NULL && G->topologia->vecinos_comprimidos != NULL;
+}
+
+/**
+ * @fun: VecinosDelIndice(Grafo G, u32 indice, u32 buffer[]).
+ * @param G: un grafo correctamente construido.
+ * @param indice: índice de un vértice en el arreglo de vértices.
+ * @param buffer: arreglo de al menos delta grande elementos, usado sólo si
+ * la topología está comprimida.
+ * @return: los índices de los vecinos del vértice: su tramo del arreglo de
+ * vecinos, o buffer con los vecinos decodificados.
+ */
+const u32 *VecinosDelIndice(Grafo G, u32 indice, u32 buffer[]) {
+    if (!EstaComprimido(G)) {
+        return G->array_vecinos + G->inicio_vecinos[indice];
+    }
+    TopologiaSt *topologia = G->topologia;
+    DecodificarVecinos(topologia->vecinos_comprimidos +
+                       topologia->inicio_comprimido[indice], indice,
+                       G->infoVertices[Grado][indice], buffer);
+    return buffer;
+}
+
+/**
+ * @fun: VecinosEnCache(Grafo G, u32 indice).
+ * @param G: un grafo correctamente construido.
+ * @param indice: índice de un vértice en el arreglo de vértices.
+ * @brief: como VecinosDelIndice() pero decodificando en el arreglo propio
+ * del grafo, que se reutiliza mientras se consulte el mismo vértice. Así
+ * recorrer los vecinos de un vértice de a uno, como hace Greedy con
+ * ColorJotaesimoVecino(), decodifica cada vértice una sola vez.
+ * @return: los índices de los vecinos del vértice; válidos hasta la próxima
+ * consulta de otro vértice en G.
+ */
+const u32 *VecinosEnCache(Grafo G, u32 indice) {
+    if (!EstaComprimido(G)) {
+        return G->array_vecinos + G->inicio_vecinos[indice];
+    }
+    if (G->vertice_decodificado != indice) {
+        VecinosDelIndice(G, indice, G->vecinos_decodificados);
+        G->vertice_decodificado = indice;
+    }
+    return G->vecinos_decodificados;
+}
+
+/**
+ * @fun: ComprimirGrafo(Grafo G).
+ * @param G: un grafo correctamente construido, con vecinos sin repetir, cuya
+ * topología no comparte con ninguna copia ni está en un archivo mapeado.
+ * @brief: ordena los vecinos de cada vértice, los codifica en una topología
+ * nueva del tamaño justo y libera la anterior.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char ComprimirGrafo(Grafo G) {
+    if (G == NULL) return 1;
+    TopologiaSt *anterior = G->topologia;
+    if (EstaComprimido(G)) return 0;
+    if (anterior == NULL || anterior->referencias != 1 ||
+        anterior->mapeo != NULL) return 1;
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *grados = G->infoVertices[Grado];
+    // El arreglo de vecinos decodificados se pide antes de cambiar nada.
+    G->vecinos_decodificados = ArenaAlocar(G->arena,
+            ((size_t)G->infoGrafo[DeltaGrande] + 1) * sizeof(u32));
+    if (G->vecinos_decodificados == NULL) return 1;
+    G->vertice_decodificado = UINT_MAX;
+
+    // Primera pasada: ordenamos los vecinos de cada vértice en su lugar,
+    // ya que el arreglo se descarta, y contamos los bytes que ocupan.
+    size_t total = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 *vecinos_v = G->array_vecinos + G->inicio_vecinos[i];
+        qsort(vecinos_v, grados[i], sizeof(u32), ascendente);
+        total += TamanioVecinosComprimidos(i, vecinos_v, grados[i]);
+    }
+
+    // Los comienzos se guardan en u32, como en la topología sin comprimir.
+    if (total > UINT_MAX) return 1;
+    // Creamos la topología nueva con lugar justo para los vecinos
+    // comprimidos y sus comienzos.
+    size_t tam_inicios = ((size_t)numVertices + 1) * sizeof(u32);
+    G->topologia = NULL;
+    if (CrearTopologia(G, tam_inicios + total + 3 * ARENA_ALINEACION,
+                       anterior->arena->paginas_grandes)) {
+        G->topologia = anterior;
+        return 1;
+    }
+    TopologiaSt *topologia = G->topologia;
+    topologia->inicio_comprimido = ArenaAlocar(topologia->arena, tam_inicios);
+    // Al menos un byte, para no pedir un bloque vacío si no hay lados.
+    topologia->vecinos_comprimidos = ArenaAlocar(topologia->arena,
+                                                 total + 1);
+
+    // Segunda pasada: codificamos los vecinos de cada vértice.
+    unsigned char *cursor = topologia->vecinos_comprimidos;
+    for (u32 i = 0; i < numVertices; i++) {
+        topologia->inicio_comprimido[i] =
+                (u32)(cursor - topologia->vecinos_comprimidos);
+        cursor = CodificarVecinos(cursor, i,
+                                  G->array_vecinos + G->inicio_vecinos[i],
+                                  grados[i]);
+    }
+    topologia->inicio_comprimido[numVertices] = (u32)total;
+
+    // La topología anterior no la usa nadie más, así que se libera.
+    ArenaDestruir(anterior->arena);
+    G->array_vecinos = NULL;
+    G->inicio_vecinos = NULL;
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file: Comprimido.h
+ * @brief: fichero de las funciones para guardar los vecinos del grafo
+ * comprimidos y leerlos. Los vecinos de cada vértice se ordenan y se guardan
+ * como diferencias entre vecinos consecutivos, cada una codificada en un
+ * entero de longitud variable (7 bits por byte, el bit alto indica que sigue
+ * otro byte). El primer vecino se guarda como su diferencia con el propio
+ * vértice, con signo en zigzag, que es chica si los índices se reasignaron
+ * con Cuthill-McKee o BFS.
+ */
+
+#ifndef COMPRIMIDO_H
+#define COMPRIMIDO_H
+
+#include "Rii.h"
+
+/**
+ * @fun: ZigZag(u32 vertice, u32 vecino).
+ * @param vertice: índice de un vértice.
+ * @param vecino: índice de su primer vecino.
+ * @return: la diferencia vecino - vertice, con signo, llevada a un entero
+ * sin signo de forma que las diferencias chicas den números chicos.
+ */
+u32 ZigZag(u32 vertice, u32 vecino);
+
+/**
+ * @fun: DesZigZag(u32 vertice, u32 codigo).
+ * @param vertice: índice de un vértice.
+ * @param codigo: resultado de ZigZag(vertice, vecino).
+ * @return: el índice vecino.
+ */
+u32 DesZigZag(u32 vertice, u32 codigo);
+
+/**
+ * @fun: TamanioVarint(u32 valor).
+ * @param valor: un entero.
+ * @return: la cantidad de bytes que ocupa valor codificado.
+ */
+size_t TamanioVarint(u32 valor);
+
+/**
+ * @fun: EscribirVarint(unsigned char *destino, u32 valor).
+ * @param destino: lugar donde escribir.
+ * @param valor: entero a codificar.
+ * @return: la posición siguiente al último byte escrito.
+ */
+unsigned char *EscribirVarint(unsigned char *destino, u32 valor);
+
+/**
+ * @fun: LeerVarint(const unsigned char *origen, u32 *valor).
+ * @param origen: comienzo de un entero codificado.
+ * @param valor: lugar donde guardar el entero.
+ * @return: la posición siguiente al último byte leído.
+ */
+const unsigned char *LeerVarint(const unsigned char *origen, u32 *valor);
+
+/**
+ * @fun: TamanioVecinosComprimidos(u32 vertice, const u32 vecinos[],
+ *                                 u32 grado).
+ * @param vertice: índice de un vértice.
+ * @param vecinos: sus vecinos, de menor a mayor.
+ * @param grado: su grado.
+ * @return: la cantidad de bytes que ocupan sus vecinos comprimidos.
+ */
+size_t TamanioVecinosComprimidos(u32 vertice, const u32 vecinos[], u32 grado);
+
+/**
+ * @fun: CodificarVecinos(unsigned char *destino, u32 vertice,
+ *                        const u32 vecinos[], u32 grado).
+ * @param destino: lugar donde escribir.
+ * @param vertice: índice de un vértice.
+ * @param vecinos: sus vecinos, de menor a mayor y sin repetir.
+ * @param grado: su grado.
+ * @return: la posición siguiente al último byte escrito.
+ */
+unsigned char *CodificarVecinos(unsigned char *destino, u32 vertice,
+                                const u32 vecinos[], u32 grado);
+
+/**
+ * @fun: DecodificarVecinos(const unsigned char *origen, u32 vertice,
+ *                          u32 grado, u32 destino[]).
+ * @param origen: comienzo de los vecinos comprimidos de un vértice.
+ * @param vertice: índice del vértice.
+ * @param grado: su grado.
+ * @param destino: arreglo de al menos grado elementos donde escribir los
+ * índices de sus vecinos.
+ * @brief: decodifica los vecinos de un vértice. Las diferencias de un byte,
+ * que son la gran mayoría, se leen sin entrar al ciclo general.
+ */
+void DecodificarVecinos(const unsigned char *origen, u32 vertice, u32 grado,
+                        u32 destino[]);
+
+/**
+ * @fun: EstaComprimido(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @return: true si la topología del grafo está comprimida; false si no.
+ */
+bool EstaComprimido(Grafo G);
+
+/**
+ * @fun: VecinosDelIndice(Grafo G, u32 indice, u32 buffer[]).
+ * @param G: un grafo correctamente construido.
+ * @param indice: índice de un vértice en el arreglo de vértices.
+ * @param buffer: arreglo de al menos delta grande elementos, usado sólo si
+ * la topología está comprimida.
+ * @return: los índices de los vecinos del vértice: su tramo del arreglo de
+ * vecinos, o buffer con los vecinos decodificados.
+ */
+const u32 *VecinosDelIndice(Grafo G, u32 indice, u32 buffer[]);
+
+/**
+ * @fun: VecinosEnCache(Grafo G, u32 indice).
+ * @param G: un grafo correctamente construido.
+ * @param indice: índice de un vértice en el arreglo de vértices.
+ * @brief: como VecinosDelIndice() pero decodificando en el arreglo propio
+ * del grafo, que se reutiliza mientras se consulte el mismo vértice. Así
+ * recorrer los vecinos de un vértice de a uno, como hace Greedy con
+ * ColorJotaesimoVecino(), decodifica cada vértice una sola vez.
+ * @return: los índices de los vecinos del vértice; válidos hasta la próxima
+ * consulta de otro vértice en G.
+ */
+const u32 *VecinosEnCache(Grafo G, u32 indice);
+
+/**
+ * @fun: ComprimirGrafo(Grafo G).
+ * @param G: un grafo correctamente construido, con vecinos sin repetir, cuya
+ * topología no comparte con ninguna copia ni está en un archivo mapeado.
+ * @brief: ordena los vecinos de cada vértice, los codifica en una topología
+ * nueva del tamaño justo y libera la anterior.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char ComprimirGrafo(Grafo G);
+
+#endif // COMPRIMIDO_H
@@ -13,33 +13,105 @@
  * ingresado por standard input en el formato DIMACS especificado.
  */
 Grafo ConstruccionDelGrafo() {
-    // Variable en la que cargar los datos leidos con la funcion CargaDatos().
-    datos_t carga_inicial = NULL;
     // Se obtiene una estructura con los datos leidos usando la funcion
-    // CargaDatos().
-    carga_inicial = CargaDatos();
+    // CargaDatos() y se construye el grafo a partir de ella con las opciones
+    // por defecto.
+    return ConstruirGrafoDesdeDatos(CargaDatos(), NULL);
+}
+
+/**
+ * @fun: OpcionesConstruccionPorDefecto(OpcionesConstruccion *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que se construye un grafo cuando no se
+ * indica otra cosa: lectura secuencial, rechazo de los lados repetidos,
+ * páginas de tamaño normal, sin reetiquetar los vértices y sin comprimir
+ * sus vecinos.
+ */
+void OpcionesConstruccionPorDefecto(OpcionesConstruccion *opciones) {
+    opciones->num_hilos = 1;
+    opciones->lados_repetidos = RechazarRepetidos;
+    opciones->paginas_grandes = false;
+    opciones->reetiquetado = SinReetiquetar;
+    opciones->comprimir_vecinos = false;
+}
+
+/**
+ * @fun: ConstruccionDelGrafoDesdeArchivo(const char *ruta,
+ *                                        const OpcionesConstruccion *opciones).
+ * @param ruta: ruta de un archivo en formato DIMACS.
+ * @param opciones: opciones de construcción, o NULL para usar las opciones
+ * por defecto. Con num_hilos igual a 1 el archivo se lee secuencialmente y
+ * con 0 se usan todos los procesadores.
+ * @return: Devuelve una estructura Grafo con la información del grafo del
+ * archivo, leído mapeándolo en memoria; NULL si hubo errores.
+ */
+Grafo ConstruccionDelGrafoDesdeArchivo(const char *ruta,
+                                       const OpcionesConstruccion *opciones) {
+    OpcionesConstruccion por_defecto;
+    if (opciones == NULL) {
+        OpcionesConstruccionPorDefecto(&por_defecto);
+        opciones = &por_defecto;
+    }
+    if (opciones->num_hilos == 1) {
+        return ConstruirGrafoDesdeDatos(CargaDatosArchivo(ruta), opciones);
+    }
+    return ConstruirGrafoDesdeDatos(
+            CargaDatosArchivoParalelo(ruta, opciones->num_hilos), opciones);
+}
+
+/**
+ * @fun: ConstruirGrafoDesdeDatos(datos_t carga_inicial,
+ *                                const OpcionesConstruccion *opciones).
+ * @param carga_inicial: estructura con los lados leídos, o NULL si la lectura
+ * falló. Sus campos nombre_minimo y nombre_maximo tienen que abarcar todos
+ * los nombres de los lados, como los dejan las funciones de Carga.h; si no,
+ * los nombres de afuera se rechazan como error. La estructura se destruye
+ * antes de volver.
+ * @param opciones: opciones de construcción, o NULL para usar las opciones
+ * por defecto.
+ * @return: Devuelve una estructura Grafo construida a partir de los lados de
+ * carga_inicial; NULL si hubo errores.
+ */
+Grafo ConstruirGrafoDesdeDatos(datos_t carga_inicial,
+                               const OpcionesConstruccion *opciones) {
+    OpcionesConstruccion por_defecto;
+    if (opciones == NULL) {
+        OpcionesConstruccionPorDefecto(&por_defecto);
+        opciones = &por_defecto;
+    }
     // Si hay un error en la carga de los datos, se devuelve NULL y no se
     // construye nada.
     if (carga_inicial == NULL) return NULL;
     // Si carga_inicial leyo correctamente, empezamos a construir el grafo...
     // Variable en la que cargar el grafo a crear.
     Grafo grafo_nuevo;
-    // Se aloca memoria para los elementos del grafo a construir.
-    grafo_nuevo = calloc(1, sizeof(GrafoSt));
+    // Toda la memoria del grafo sale de su arena, con lugar para todos sus
+    // arreglos; como el grado máximo todavía no se conoce, se reserva para
+    // la cantidad de colores como si fuera la cantidad de vértices.
+    u32 numVertices = carga_inicial->cant_vertices;
+    Arena *arena = ArenaCrear(TamanioArenaGrafo(numVertices, numVertices),
+                              opciones->paginas_grandes);
     // Si falla lo anterior entonces devolvemos NULL.
-    if (grafo_nuevo == NULL) return NULL;
+    if (arena == NULL) {
+        DestruccionCargaDatos(carga_inicial);
+        return NULL;
+    }
+    // Se aloca memoria para los elementos del grafo a construir.
+    grafo_nuevo = ArenaAlocarCeros(arena, 1, sizeof(GrafoSt));
+    grafo_nuevo->arena = arena;
 
     // Se establece el numero de vértices y el número de lados.
-    grafo_nuevo->infoGrafo[Vertices] = carga_inicial->cant_vertices;
+    grafo_nuevo->infoGrafo[Vertices] = numVertices;
     grafo_nuevo->infoGrafo[Lados] = carga_inicial->cant_lados;
 
-    // Pedimos memoria para el arreglo de vértices...
-    // Este es un arreglo de estructuras vértices por lo que contendrá la
-    // información de cada vértice.
-    grafo_nuevo->array_vertices = calloc(carga_inicial->cant_vertices,
-                                         sizeof(VerticeSt));
-    // Si falla devolvemos NULL.
-    if (grafo_nuevo->array_vertices == NULL) return NULL;
+    // Pedimos memoria para la información de los vértices...
+    // Un arreglo por cada dato (nombre, grado y color), cada uno con una
+    // posición por vértice. La arena se creó con lugar para ellos y para el
+    // arreglo de orden, así que no pueden fallar.
+    for (u32 x = Nombre; x <= Color; x++) {
+        grafo_nuevo->infoVertices[x] = ArenaAlocarCeros(arena, numVertices,
+                                                        sizeof(u32));
+    }
 
     // Pedimos memoria para el arreglo de orden de los vértices...
     // El orden de los vértices en este grafo estará dado por este arreglo,
@@ -48,69 +120,48 @@ Grafo ConstruccionDelGrafo() {
     // vértice del orden, en la 1 el segundo y así sucesivamente.
     // Para modificar el orden se modifica este arreglo mientras que el arreglo
     // de vértices permanece invariable.
-    grafo_nuevo->array_orden_vertices = calloc(carga_inicial->cant_vertices,
-                                               sizeof(u32));
-    // Si falla devolvemos NULL.
-    if (grafo_nuevo->array_orden_vertices == NULL) return NULL;
+    grafo_nuevo->array_orden_vertices = ArenaAlocar(arena, numVertices *
+                                                    sizeof(u32));
 
-    // Ahora tenemos que agregar los vértices del grafo...
-    // Creamos una tabla Hash.
-    hash_t *hash = hash_crear(free);
+    // Los arreglos de vecinos salen de la arena de la topología, que no
+    // cambia una vez construido el grafo y se comparte con sus copias.
+    // Sin reetiquetar, los vecinos comprimidos se codifican directo desde
+    // los lados y la arena sólo necesita lugar para los comienzos; los
+    // vecinos comprimidos se piden cuando se sabe su tamaño.
+    bool comprimir_al_construir = opciones->comprimir_vecinos &&
+                                  opciones->reetiquetado == SinReetiquetar;
+    size_t tam_topologia = TamanioArenaTopologia(numVertices,
+            comprimir_al_construir ? 0 : carga_inicial->cant_lados);
 
-    // Varible que cuenta la cantidad de vertices ingresados al grafo nuevo
-    // hasta el momento. Si se alocó memoria entonces estará estára
-    // inicializada en 0.
-    u32 *vertices_ingresados = calloc(1, sizeof(u32));
-    // Si falla lo anterior devolvemos NULL.
-    if (vertices_ingresados == NULL) return NULL;
+    // Ahora tenemos que agregar los vértices del grafo...
+    // Creamos el mapa que asocia el nombre de cada vértice con su índice;
+    // según el rango de nombres será un arreglo directo o una tabla hash.
+    MapaNombres mapa;
+    if (CrearTopologia(grafo_nuevo, tam_topologia, opciones->paginas_grandes)
+        || CrearMapaNombres(&mapa, carga_inicial)) {
+        DestruccionDelGrafo(grafo_nuevo);
+        DestruccionCargaDatos(carga_inicial);
+        return NULL;
+    }
 
     // Variable error para controlar si hay errores en los pasos que siguen.
     bool error;
 
-    // Recorremos el arreglo de lados de la carga_incial.
-    for (u32 i = 0; i < (grafo_nuevo->infoGrafo[Lados]) * 2; i += 2) {
-        // Para cada par de lados...
-        for (u32 j = 0; j < 2; j++) {
-            // Llamamos a la función AgregarVertice() pasándole
-            // como vértice a agregar uno de cada lado por vez; como se ve
-            // carga_inicial->arreglo_lados[i+j] se corresponderá con
-            // carga_inicial->arreglo_lados[i] primero y luego con
-            // carga_inicial->arreglo_lados[i+1] variando el i de dos en dos.
-            error = AgregarVertice(hash, grafo_nuevo, vertices_ingresados,
-                                   carga_inicial->arreglo_lados[i+j]);
-            // Si se reportó un error entonces...
-            if (error) {
-                // Destruimos el grafo creado hasta el momento y liberamos
-                // memoria.
-                DestruccionDelGrafo(grafo_nuevo);
-                grafo_nuevo = NULL;
-                // goto FREE nos lleva a las últimas sentencias para liberar el
-                // resto de las estructuras de memoria.
-                goto FREE;
-            }
-        }
-    }
-
-    // Si se terminó el ciclo for anterior, entonces contabilizamos que los
-    // vertices ingresados en el la estructura sean la cantidad declarada
-    // por el formato de entrada. Si faltaron vertices por ingresar entonces
-    // liberamos memoria de las estructuras usadas y devolvemos NULL.
-    if (FaltanVertices(grafo_nuevo->infoGrafo[Vertices], *vertices_ingresados)) {
-        printf("Cantidad de vértices leidos no es la declarada\n");
-        DestruccionDelGrafo(grafo_nuevo);
-        grafo_nuevo = NULL;
-        goto FREE;
+    // Si se piden varios hilos usamos la construcción paralela, que da el
+    // mismo grafo que la secuencial. La comprimida es secuencial.
+    if (comprimir_al_construir) {
+        error = IndexarLados(&mapa, grafo_nuevo, carga_inicial) ||
+                AgregarVecinosComprimidos(grafo_nuevo, carga_inicial,
+                                          opciones);
+    } else if (opciones->num_hilos != 1) {
+        error = IndexarLados(&mapa, grafo_nuevo, carga_inicial) ||
+                AgregarVecinosParalelo(grafo_nuevo, carga_inicial, opciones);
+    } else {
+        error = AgregarVerticesYVecinos(&mapa, grafo_nuevo, carga_inicial,
+                                        opciones);
     }
 
-    // Luego si llegamos hasta acá para cada vértice tenemos que agregar sus
-    // vecinos.
-    // Usamos la funcion AgregarVecinos, que aloja memoria para el arreglo de
-    // vecinos para cada vértice según su grado, y despues usa la carga_inicial
-    // y la tabla hash generada para buscar los índices correspondientes y
-    // almacenarlos cruzadamente entre vecinos.
-    error = AgregarVecinos(grafo_nuevo, carga_inicial, hash);
-
-    // Si ocurrio un error en la función anterior, entonces...
+    // Si ocurrio un error en la construcción, entonces...
     if (error) {
         // Destruimos lo construido y liberamos las estructuras de mermoria y
         // devolvemos NULL;
@@ -124,7 +175,19 @@ Grafo ConstruccionDelGrafo() {
     // establece el valor de la delta grande...
     error = InicializarGrafo(grafo_nuevo);
 
-    // Si ocurrio un error en la función anterior, entonces...
+    // Si se pidió, reasignamos los índices de los vértices para mejorar la
+    // localidad; el orden y el coloreo que dio Greedy no cambian.
+    if (!error) {
+        error = ReetiquetarGrafo(grafo_nuevo, opciones->reetiquetado);
+    }
+    // Si se pidió y no se comprimieron al construir, comprimimos los
+    // vecinos; conviene hacerlo después de reetiquetar, porque los vecinos
+    // cercanos se codifican en menos bytes.
+    if (!error && opciones->comprimir_vecinos) {
+        error = ComprimirGrafo(grafo_nuevo);
+    }
+
+    // Si ocurrio un error en alguna de las funciones anteriores, entonces...
     if (error) {
         // Destruimos lo construido y liberamos las estructuras de mermoria y
         // devolvemos NULL;
@@ -133,90 +196,552 @@ Grafo ConstruccionDelGrafo() {
     }
     // Liberamos el resto de las estructuras...
     FREE:
-        free(vertices_ingresados);
-        hash_destruir(hash);
+        DestruirMapaNombres(&mapa);
         DestruccionCargaDatos(carga_inicial);
         return grafo_nuevo;
 }
 
 /**
- * @fun: AgregarVertice(hash_t *HashTable, Grafo grafo, u32 *VerticesIngresados,
-                        u32 vertice).
- * @param HashTable: una tabla hash creada.
+ * @fun: AgregarVerticesYVecinos(MapaNombres *mapa, Grafo grafo,
+ *                               datos_t carga,
+ *                               const OpcionesConstruccion *opciones).
+ * @param mapa: un mapa de nombres creado y vacío.
+ * @param grafo: una estructura grafo con sus arreglos de vértices y de orden
+ * alocados.
+ * @param carga: estructura datos_t con los lados leídos.
+ * @param opciones: opciones de construcción.
+ * @brief: construcción secuencial; agrega los vértices contando sus grados y
+ * luego los vecinos de cada uno.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool AgregarVerticesYVecinos(MapaNombres *mapa, Grafo grafo, datos_t carga,
+                             const OpcionesConstruccion *opciones) {
+    // Varible que cuenta la cantidad de vertices ingresados al grafo nuevo
+    // hasta el momento.
+    u32 vertices_ingresados = 0;
+    // Variable error para controlar si hay errores en los pasos que siguen.
+    bool error;
+
+    // Recorremos el arreglo de lados de la carga.
+    for (u32 i = 0; i < (grafo->infoGrafo[Lados]) * 2; i += 2) {
+        // Para cada par de lados...
+        for (u32 j = 0; j < 2; j++) {
+            // Llamamos a la función AgregarVertice() pasándole
+            // como vértice a agregar uno de cada lado por vez; como se ve
+            // carga->arreglo_lados[i+j] se corresponderá con
+            // carga->arreglo_lados[i] primero y luego con
+            // carga->arreglo_lados[i+1] variando el i de dos en dos.
+            error = AgregarVertice(mapa, grafo, &vertices_ingresados,
+                                   carga->arreglo_lados[i+j]);
+            // Si se reportó un error lo devolvemos.
+            if (error) return true;
+        }
+    }
+
+    // Si se terminó el ciclo for anterior, entonces contabilizamos que los
+    // vertices ingresados en el la estructura sean la cantidad declarada
+    // por el formato de entrada.
+    if (FaltanVertices(grafo->infoGrafo[Vertices], vertices_ingresados)) {
+        printf("Cantidad de vértices leidos no es la declarada\n");
+        return true;
+    }
+
+    // Luego si llegamos hasta acá para cada vértice tenemos que agregar sus
+    // vecinos.
+    // Usamos la funcion AgregarVecinos, que aloja memoria para el arreglo de
+    // vecinos para cada vértice según su grado, y despues usa la carga
+    // y el mapa de nombres para buscar los índices correspondientes y
+    // almacenarlos cruzadamente entre vecinos.
+    return AgregarVecinos(grafo, carga, mapa, opciones);
+}
+
+/**
+ * @fun: IndexarLados(MapaNombres *mapa, Grafo grafo, datos_t carga).
+ * @param mapa: un mapa de nombres creado y vacío.
+ * @param grafo: una estructura grafo con su arreglo de vértices alocado.
+ * @param carga: estructura datos_t con los lados leídos.
+ * @brief: primera etapa de la construcción paralela y de la comprimida.
+ * Asigna a cada vértice su índice en el mismo orden que AgregarVertice() y
+ * reemplaza en el arreglo de lados de la carga cada nombre por su índice,
+ * para que las etapas siguientes no tengan que consultar el mapa.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool IndexarLados(MapaNombres *mapa, Grafo grafo, datos_t carga) {
+    u32 vertices_ingresados = 0;
+    size_t cant_extremos = 2 * (size_t)grafo->infoGrafo[Lados];
+    for (size_t i = 0; i < cant_extremos; i++) {
+        u32 nombre = carga->arreglo_lados[i];
+        u32 indice = ObtenerOGuardarIndice(mapa, nombre, vertices_ingresados);
+        if (indice == HASH_U32_VACIO) return true;
+        if (indice == vertices_ingresados) {
+            if (indice == grafo->infoGrafo[Vertices]) {
+                printf("Cantidad de vértices leidos no es la declarada\n");
+                return true;
+            }
+            grafo->infoVertices[Nombre][indice] = nombre;
+            vertices_ingresados++;
+        }
+        carga->arreglo_lados[i] = indice;
+    }
+    if (FaltanVertices(grafo->infoGrafo[Vertices], vertices_ingresados)) {
+        printf("Cantidad de vértices leidos no es la declarada\n");
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @fun: ContarGradosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion.
+ * @brief: cuenta en el histograma propio del trozo cuántas veces aparece cada
+ * vértice en los lados del trozo.
+ * @return: NULL.
+ */
+void *ContarGradosTrozo(void *trozo) {
+    TrozoConstruccion *t = trozo;
+    for (size_t i = 2 * (size_t)t->primer_lado;
+         i < 2 * (size_t)t->fin_lados; i++) {
+        t->grados[t->lados[i]]++;
+    }
+    return NULL;
+}
+
+/**
+ * @fun: SumarGradosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion.
+ * @brief: para los vértices del trozo suma los histogramas de todos los
+ * trozos, guarda el grado de cada vértice y la suma de esos grados.
+ * @return: NULL.
+ */
+void *SumarGradosTrozo(void *trozo) {
+    TrozoConstruccion *t = trozo;
+    u32 *grados = t->grafo->infoVertices[Grado];
+    t->suma_grados = 0;
+    for (u32 v = t->primer_vertice; v < t->fin_vertices; v++) {
+        u32 grado = 0;
+        for (u32 k = 0; k < t->num_trozos; k++) {
+            grado += t->trozos[k].grados[v];
+        }
+        grados[v] = grado;
+        t->suma_grados += grado;
+    }
+    return NULL;
+}
+
+/**
+ * @fun: UbicarVecinosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion cuyo campo
+ * suma_grados tiene el comienzo de los vecinos de su primer vértice.
+ * @brief: para los vértices del trozo fija el comienzo de sus vecinos y
+ * convierte el histograma de cada trozo en un cursor: la posición siguiente
+ * a la última que ese trozo llena. Como la construcción secuencial llena los
+ * vecinos de atrás para adelante, los trozos anteriores quedan al final.
+ * @return: NULL.
+ */
+void *UbicarVecinosTrozo(void *trozo) {
+    TrozoConstruccion *t = trozo;
+    Grafo grafo = t->grafo;
+    u32 inicio = t->suma_grados;
+    for (u32 v = t->primer_vertice; v < t->fin_vertices; v++) {
+        grafo->inicio_vecinos[v] = inicio;
+        inicio += grafo->infoVertices[Grado][v];
+        u32 cursor = inicio;
+        for (u32 k = 0; k < t->num_trozos; k++) {
+            u32 cantidad = t->trozos[k].grados[v];
+            t->trozos[k].grados[v] = cursor;
+            cursor -= cantidad;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @fun: LlenarVecinosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion con los cursores
+ * calculados por UbicarVecinosTrozo().
+ * @brief: escribe los vecinos de los lados del trozo en su posición final.
+ * Cada trozo usa sólo sus cursores, por lo que no hace falta sincronizar.
+ * @return: NULL.
+ */
+void *LlenarVecinosTrozo(void *trozo) {
+    TrozoConstruccion *t = trozo;
+    u32 *vecinos = t->grafo->array_vecinos;
+    for (size_t i = 2 * (size_t)t->primer_lado;
+         i < 2 * (size_t)t->fin_lados; i += 2) {
+        u32 vertice_1 = t->lados[i];
+        u32 vertice_2 = t->lados[i + 1];
+        vecinos[--t->grados[vertice_1]] = vertice_2;
+        vecinos[--t->grados[vertice_2]] = vertice_1;
+    }
+    return NULL;
+}
+
+/**
+ * @fun: AgregarVecinosParalelo(Grafo G, datos_t carga,
+ *                              const OpcionesConstruccion *opciones).
+ * @param G: estructura Grafo con los nombres de los vértices cargados.
+ * @param carga: estructura datos_t con los lados ya indexados por
+ * IndexarLados().
+ * @param opciones: opciones de construcción; num_hilos indica la cantidad de
+ * hilos y lados_repetidos qué hacer con los lados repetidos.
+ * @brief: como AgregarVecinos() pero en paralelo. Cada hilo cuenta los
+ * grados de un trozo de lados en un histograma propio, una suma de prefijos
+ * por trozos de vértices da el comienzo de los vecinos de cada vértice y
+ * cada hilo escribe los vecinos de sus lados. El resultado es idéntico al de
+ * la construcción secuencial, incluso en el orden de los vecinos.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool AgregarVecinosParalelo(Grafo G, datos_t carga,
+                            const OpcionesConstruccion *opciones) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 numLados = G->infoGrafo[Lados];
+    // Elegimos la cantidad de hilos, sin hacer trozos demasiado chicos.
+    u32 num_hilos = opciones->num_hilos;
+    if (num_hilos == 0) num_hilos = CantidadDeProcesadores();
+    if (numLados / MINIMO_LADOS_POR_HILO < num_hilos) {
+        num_hilos = numLados / MINIMO_LADOS_POR_HILO;
+    }
+    if (num_hilos == 0) num_hilos = 1;
+
+    TrozoConstruccion *trozos = calloc(num_hilos, sizeof(TrozoConstruccion));
+    u32 *histogramas = calloc((size_t)num_hilos * numVertices, sizeof(u32));
+    Arena *arena = G->topologia->arena;
+    G->array_vecinos = ArenaAlocar(arena, 2 * (size_t)numLados * sizeof(u32));
+    G->inicio_vecinos = ArenaAlocar(arena, ((size_t)numVertices + 1) *
+                                           sizeof(u32));
+    if (trozos == NULL || histogramas == NULL || G->array_vecinos == NULL ||
+        G->inicio_vecinos == NULL) {
+        free(trozos);
+        free(histogramas);
+        return true;
+    }
+    // Repartimos en partes iguales los lados y los vértices.
+    for (u32 k = 0; k < num_hilos; k++) {
+        trozos[k].grafo = G;
+        trozos[k].lados = carga->arreglo_lados;
+        trozos[k].primer_lado = (u32)((size_t)numLados * k / num_hilos);
+        trozos[k].fin_lados = (u32)((size_t)numLados * (k + 1) / num_hilos);
+        trozos[k].primer_vertice = (u32)((size_t)numVertices * k / num_hilos);
+        trozos[k].fin_vertices =
+                (u32)((size_t)numVertices * (k + 1) / num_hilos);
+        trozos[k].grados = histogramas + (size_t)k * numVertices;
+        trozos[k].trozos = trozos;
+        trozos[k].num_trozos = num_hilos;
+    }
+
+    size_t tam = sizeof(TrozoConstruccion);
+    EjecutarEnHilos(ContarGradosTrozo, trozos, tam, num_hilos);
+    EjecutarEnHilos(SumarGradosTrozo, trozos, tam, num_hilos);
+    // Suma de prefijos de los grados de cada trozo de vértices.
+    u32 inicio = 0;
+    for (u32 k = 0; k < num_hilos; k++) {
+        u32 suma = trozos[k].suma_grados;
+        trozos[k].suma_grados = inicio;
+        inicio += suma;
+    }
+    G->inicio_vecinos[numVertices] = inicio;
+    EjecutarEnHilos(UbicarVecinosTrozo, trozos, tam, num_hilos);
+    EjecutarEnHilos(LlenarVecinosTrozo, trozos, tam, num_hilos);
+
+    free(trozos);
+    free(histogramas);
+    return TratarVecinosRepetidos(G, opciones);
+}
+
+/**
+ * @fun: UbicarTramo(TramoComprimido *tramo, u32 primero).
+ * @param tramo: estructura con las apariciones de cada vértice y la
+ * capacidad del tramo, que es al menos la mayor de las apariciones.
+ * @param primero: primer vértice del tramo.
+ * @brief: toma desde primero tantos vértices como entren en la capacidad y
+ * pone el cursor de cada uno al final de su lugar, ya que los vecinos se
+ * llenan de atrás para adelante.
+ */
+void UbicarTramo(TramoComprimido *tramo, u32 primero) {
+    u32 numVertices = tramo->grafo->infoGrafo[Vertices];
+    size_t ocupados = 0;
+    u32 v = primero;
+    while (v < numVertices &&
+           ocupados + tramo->apariciones[v] <= tramo->capacidad) {
+        ocupados += tramo->apariciones[v];
+        tramo->cursor[v] = (u32)ocupados;
+        v++;
+    }
+    tramo->primer_vertice = primero;
+    tramo->fin_vertices = v;
+}
+
+/**
+ * @fun: ArmarTramo(TramoComprimido *tramo,
+ *                  enum LadosRepetidos lados_repetidos).
+ * @param tramo: estructura con un tramo ubicado por UbicarTramo().
+ * @param lados_repetidos: qué hacer con los lados repetidos.
+ * @brief: recorre todos los lados llenando los vecinos de los vértices del
+ * tramo, los ordena de menor a mayor, quita los repetidos y guarda el grado
+ * que queda. Al terminar, el cursor de cada vértice es el comienzo de sus
+ * vecinos.
+ * @return: true si hay lados repetidos y deben rechazarse; false en caso
+ * contrario.
+ */
+bool ArmarTramo(TramoComprimido *tramo, enum LadosRepetidos lados_repetidos) {
+    u32 primero = tramo->primer_vertice;
+    u32 cantidad = tramo->fin_vertices - primero;
+    const u32 *lados = tramo->lados;
+    // Con la resta sin signo, un vértice anterior al tramo también da una
+    // diferencia mayor o igual a cantidad.
+    for (size_t i = 0; i < tramo->cant_extremos; i += 2) {
+        u32 vertice_1 = lados[i];
+        u32 vertice_2 = lados[i + 1];
+        if (vertice_1 - primero < cantidad) {
+            tramo->vecinos[--tramo->cursor[vertice_1]] = vertice_2;
+        }
+        if (vertice_2 - primero < cantidad) {
+            tramo->vecinos[--tramo->cursor[vertice_2]] = vertice_1;
+        }
+    }
+    u32 *grados = tramo->grafo->infoVertices[Grado];
+    for (u32 v = primero; v < tramo->fin_vertices; v++) {
+        u32 *vecinos_v = tramo->vecinos + tramo->cursor[v];
+        u32 apariciones = tramo->apariciones[v];
+        qsort(vecinos_v, apariciones, sizeof(u32), ascendente);
+        // Ordenados, los repetidos quedan juntos y se compactan en el lugar.
+        u32 escritos = apariciones == 0 ? 0 : 1;
+        for (u32 k = 1; k < apariciones; k++) {
+            if (vecinos_v[k] != vecinos_v[escritos - 1]) {
+                vecinos_v[escritos++] = vecinos_v[k];
+            }
+        }
+        if (escritos != apariciones &&
+            lados_repetidos == RechazarRepetidos) return true;
+        grados[v] = escritos;
+    }
+    return false;
+}
+
+/**
+ * @fun: AgregarVecinosComprimidos(Grafo G, datos_t carga,
+ *                                 const OpcionesConstruccion *opciones).
+ * @param G: estructura Grafo con los nombres de los vértices cargados.
+ * @param carga: estructura datos_t con los lados ya indexados por
+ * IndexarLados().
+ * @param opciones: opciones de construcción; lados_repetidos indica qué
+ * hacer con los lados repetidos.
+ * @brief: como AgregarVecinos() pero codificando los vecinos de cada vértice
+ * directamente en la topología comprimida. Cuenta las apariciones de cada
+ * vértice y arma los vecinos de a tramos con ArmarTramo(): en una primera
+ * pasada para saber cuántos bytes ocupa cada vértice y en otra para
+ * codificarlos. Así nunca se tiene el arreglo de vecinos completo, a cambio
+ * de recorrer los lados dos veces por tramo.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool AgregarVecinosComprimidos(Grafo G, datos_t carga,
+                               const OpcionesConstruccion *opciones) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *grados = G->infoVertices[Grado];
+    TopologiaSt *topologia = G->topologia;
+    TramoComprimido tramo;
+    tramo.grafo = G;
+    tramo.lados = carga->arreglo_lados;
+    tramo.cant_extremos = 2 * (size_t)G->infoGrafo[Lados];
+    tramo.apariciones = calloc(numVertices, sizeof(u32));
+    tramo.cursor = malloc((size_t)numVertices * sizeof(u32));
+    tramo.vecinos = NULL;
+    bool error = tramo.apariciones == NULL || tramo.cursor == NULL;
+    if (error) goto FIN;
+
+    // Contamos las apariciones de cada vértice, que son su grado si no hay
+    // lados repetidos.
+    u32 maximo = 0;
+    for (size_t i = 0; i < tramo.cant_extremos; i++) {
+        u32 apariciones = ++tramo.apariciones[tramo.lados[i]];
+        if (apariciones > maximo) maximo = apariciones;
+    }
+    // Cada tramo tiene que tener lugar al menos para el vértice de más
+    // apariciones.
+    tramo.capacidad = tramo.cant_extremos / FRACCION_TRAMO_COMPRIMIDO;
+    if (tramo.capacidad < MINIMO_VECINOS_POR_TRAMO) {
+        tramo.capacidad = MINIMO_VECINOS_POR_TRAMO;
+    }
+    if (tramo.capacidad > tramo.cant_extremos) {
+        tramo.capacidad = tramo.cant_extremos;
+    }
+    if (tramo.capacidad < maximo) tramo.capacidad = maximo;
+    // Al menos un elemento, para no pedir un bloque vacío si no hay lados.
+    tramo.vecinos = malloc((tramo.capacidad + 1) * sizeof(u32));
+    topologia->inicio_comprimido = ArenaAlocar(topologia->arena,
+            ((size_t)numVertices + 1) * sizeof(u32));
+    // El arreglo de vecinos decodificados, del tamaño del grado máximo.
+    G->vecinos_decodificados = ArenaAlocar(G->arena,
+            ((size_t)maximo + 1) * sizeof(u32));
+    G->vertice_decodificado = UINT_MAX;
+    error = tramo.vecinos == NULL || topologia->inicio_comprimido == NULL ||
+            G->vecinos_decodificados == NULL;
+
+    // Primera pasada: contamos los bytes que ocupan los vecinos de cada
+    // vértice, sin repetidos, y con eso el comienzo de cada uno.
+    size_t total = 0;
+    size_t suma_grados = 0;
+    for (u32 primero = 0; primero < numVertices && !error;
+         primero = tramo.fin_vertices) {
+        UbicarTramo(&tramo, primero);
+        if (ArmarTramo(&tramo, opciones->lados_repetidos)) {
+            printf("Hay lados repetidos\n");
+            error = true;
+        }
+        for (u32 v = primero; v < tramo.fin_vertices && !error; v++) {
+            // Los comienzos se guardan en u32, como en la topología sin
+            // comprimir.
+            if (total > UINT_MAX) error = true;
+            topologia->inicio_comprimido[v] = (u32)total;
+            total += TamanioVecinosComprimidos(v,
+                                               tramo.vecinos + tramo.cursor[v],
+                                               grados[v]);
+            suma_grados += grados[v];
+        }
+    }
+    if (error || total > UINT_MAX) {
+        error = true;
+        goto FIN;
+    }
+    topologia->inicio_comprimido[numVertices] = (u32)total;
+    // Cada lado aparece en los vecinos de sus dos extremos.
+    G->infoGrafo[Lados] = (u32)(suma_grados / 2);
+    topologia->vecinos_comprimidos = ArenaAlocar(topologia->arena, total + 1);
+    error = topologia->vecinos_comprimidos == NULL;
+
+    // Segunda pasada: armamos de nuevo cada tramo y codificamos sus vecinos
+    // en el lugar calculado.
+    for (u32 primero = 0; primero < numVertices && !error;
+         primero = tramo.fin_vertices) {
+        UbicarTramo(&tramo, primero);
+        ArmarTramo(&tramo, opciones->lados_repetidos);
+        for (u32 v = primero; v < tramo.fin_vertices; v++) {
+            CodificarVecinos(topologia->vecinos_comprimidos +
+                             topologia->inicio_comprimido[v], v,
+                             tramo.vecinos + tramo.cursor[v], grados[v]);
+        }
+    }
+
+    FIN:
+        free(tramo.apariciones);
+        free(tramo.cursor);
+        free(tramo.vecinos);
+        return error;
+}
+
+/**
+ * @fun: CrearMapaNombres(MapaNombres *mapa, datos_t carga).
+ * @param mapa: estructura a inicializar.
+ * @param carga: estructura datos_t con los lados y el rango de nombres.
+ * @brief: elige el arreglo directo si los nombres son densos, es decir si
+ * el rango de nombres no supera FACTOR_RANGO_DENSO veces la cantidad de
+ * vértices; si no, usa una tabla hash de enteros. El arreglo sólo tiene
+ * lugar para los nombres del rango de carga.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool CrearMapaNombres(MapaNombres *mapa, datos_t carga) {
+    mapa->hash = NULL;
+    mapa->indices = NULL;
+    mapa->nombre_minimo = carga->nombre_minimo;
+    mapa->rango = 0;
+    // Cantidad de nombres posibles entre el menor y el mayor, inclusive.
+    size_t rango = (size_t)carga->nombre_maximo - carga->nombre_minimo + 1;
+    if (carga->nombre_minimo <= carga->nombre_maximo &&
+        rango <= (size_t)FACTOR_RANGO_DENSO * carga->cant_vertices) {
+        mapa->indices = malloc(rango * sizeof(u32));
+        // Si no hay memoria para el arreglo probamos con la tabla hash.
+        if (mapa->indices != NULL) {
+            // Todos los bytes en 0xFF dejan cada posición en HASH_U32_VACIO.
+            memset(mapa->indices, 0xFF, rango * sizeof(u32));
+            mapa->rango = rango;
+            return false;
+        }
+    }
+    mapa->hash = hash_u32_crear(carga->cant_vertices);
+    return mapa->hash == NULL;
+}
+
+/**
+ * @fun: ObtenerOGuardarIndice(MapaNombres *mapa, u32 nombre, u32 indice).
+ * @param mapa: un mapa de nombres creado.
+ * @param nombre: nombre de un vértice.
+ * @param indice: índice a asociar con el nombre si todavía no tiene uno.
+ * @return: el índice asociado al nombre; HASH_U32_VACIO si hubo un error o
+ * el nombre está fuera del rango del arreglo directo.
+ */
+u32 ObtenerOGuardarIndice(MapaNombres *mapa, u32 nombre, u32 indice) {
+    if (mapa->indices == NULL) {
+        return hash_u32_obtener_o_guardar(mapa->hash, nombre, indice);
+    }
+    // Si el rango de la carga no abarca el nombre, la resta da una posición
+    // fuera del arreglo, incluso para nombres menores que el mínimo.
+    u32 desplazamiento = nombre - mapa->nombre_minimo;
+    if (desplazamiento >= mapa->rango) return HASH_U32_VACIO;
+    u32 *posicion = &mapa->indices[desplazamiento];
+    if (*posicion == HASH_U32_VACIO) *posicion = indice;
+    return *posicion;
+}
+
+/**
+ * @fun: ObtenerIndice(const MapaNombres *mapa, u32 nombre).
+ * @param mapa: un mapa de nombres creado.
+ * @param nombre: nombre de un vértice.
+ * @return: el índice asociado al nombre; HASH_U32_VACIO si no tiene uno.
+ */
+u32 ObtenerIndice(const MapaNombres *mapa, u32 nombre) {
+    if (mapa->indices == NULL) return hash_u32_obtener(mapa->hash, nombre);
+    u32 desplazamiento = nombre - mapa->nombre_minimo;
+    if (desplazamiento >= mapa->rango) return HASH_U32_VACIO;
+    return mapa->indices[desplazamiento];
+}
+
+/**
+ * @fun: DestruirMapaNombres(MapaNombres *mapa).
+ * @param mapa: un mapa de nombres creado.
+ * @brief: libera la memoria usada por el mapa.
+ */
+void DestruirMapaNombres(MapaNombres *mapa) {
+    free(mapa->indices);
+    mapa->indices = NULL;
+    hash_u32_destruir(mapa->hash);
+    mapa->hash = NULL;
+}
+
+/**
+ * @fun: AgregarVertice(MapaNombres *mapa, Grafo grafo,
+ *                      u32 *VerticesIngresados, u32 vertice).
+ * @param mapa: un mapa de nombres creado.
  * @param grafo: una estructura grafo cuyos vértices no han sido cargados.
  * @param VerticesIngresados: cantidad de vértices ingresados hasta el momento.
  * @param vertice: nombre del vértice a agregar.
  * @return: Devuelve false si el vértice se agregó y contabilizó su grado
  * correctamente; true, en caso de error.
  */
-bool AgregarVertice(hash_t *HashTable, Grafo grafo, u32 *VerticesIngresados,
-                    u32 vertice) {
-    // Puntero al dato a almacenar.
-    u32 *dato;
-    // Punteros para generar la clave de la tabla hash.
-    char *clave, *cadena;
-    // Variable para controlar que el vértice se guardó en la tabla hash.
-    bool fueGuardado;
-    // Puntero que señala el índice de un vértice ya incoporado en la
-    // estructura grafo.
-    u32 *Ind_array;
-
-    // Primero generamos la clave para la tabla hash, convirtiendo el nombre
-    // vértice en un string...
-    cadena = calloc(1, 11*sizeof(char));
-    // Si no se asignó memoria devolvemos true para indicar error.
-    if (cadena == NULL) return true;
-    // Con la función itoa propia convertimos el nombre del vértice en string.
-    clave = itoa_propia(vertice, cadena, 10);
-
-    //Luego tenemos que ver si el vertice se encuentra en la tabla hash,
-    // viendo si con esa clave ya hay un dato asociado o no...
-    if (!hash_pertenece(HashTable, clave)) {
-        // Si no está en la tabla Hash entonces tenemos que agregar el dato.
-        // Usamos el número de vértices ingresados hasta el momento como
-        // dato y lo agregamos...
-        dato = malloc(sizeof(u32));
-        // Si no se aloco memoria para guardar el dato, es un error...
-        if (dato == NULL) return true;
-        *dato = *VerticesIngresados;
-        // Si el dato que queremos agregar es igual a la cantidad de vértices
-        // entonces esto es un error, pues en la tabla asociados el nombre
-        // del vértice con el índice en el arreglo de vecinos; luego este
-        // indice a lo sumo va a valer num. de vertices - 1.
-        if (*dato == grafo->infoGrafo[Vertices]) {
+bool AgregarVertice(MapaNombres *mapa, Grafo grafo,
+                    u32 *VerticesIngresados, u32 vertice) {
+    // Buscamos el índice asociado al nombre del vértice. Si no estaba en el
+    // mapa se lo guarda con el número de vértices ingresados hasta el
+    // momento como índice, todo en una sola búsqueda.
+    u32 indice = ObtenerOGuardarIndice(mapa, vertice, *VerticesIngresados);
+    // Si no se pudo guardar es un error.
+    if (indice == HASH_U32_VACIO) return true;
+    // Si el índice es nuevo, el vértice no había sido ingresado...
+    if (indice == *VerticesIngresados) {
+        // Si el índice es igual a la cantidad de vértices entonces esto es un
+        // error, pues el índice a lo sumo va a valer num. de vertices - 1.
+        if (indice == grafo->infoGrafo[Vertices]) {
             printf("Cantidad de vértices leidos no es la declarada\n");
             return true;
         }
-        // Entonces lo guardamos en la misma.
-        fueGuardado = hash_guardar(HashTable, clave, dato);
-        // Si no podemos ingresarla obtenemos un error.
-        if (!fueGuardado) {
-            free(cadena);
-            return true;
-            // Si pudimos ingresarla...
-        } else {
-            // Cargamos en la posicion (*dato) el nombre (u32) del vertice en el
-            // arreglo de vértices del grafo.
-            grafo->array_vertices[*dato].infoVertice[Nombre] = vertice;
-            // Aumentamos el grado de ese vértice.
-            grafo->array_vertices[*dato].infoVertice[Grado]++;
-            // Aumentamos la cantidad de vértices ingresados hasta el momento.
-            *VerticesIngresados += 1;
-            // Liberamos la cadena y retornamos false.
-            free(cadena);
-            return false;
-        }
-        // Si hay un dato asociado con esa clave, entonces...
-    } else {
-        // obtenemos el dato asociado a dicha clave, que es el índice de un
-        // vértice ya agregado.
-        Ind_array = hash_obtener(HashTable, clave);
-        // Aumentamos el grado de dicho vértice.
-        grafo->array_vertices[*Ind_array].infoVertice[Grado]++;
-        // Liberamos la cadena y retornamos false.
-        free(cadena);
-        return false;
+        // Cargamos en la posicion indice el nombre (u32) del vertice en el
+        // arreglo de vértices del grafo.
+        grafo->infoVertices[Nombre][indice] = vertice;
+        // Aumentamos la cantidad de vértices ingresados hasta el momento.
+        *VerticesIngresados += 1;
     }
+    // Aumentamos el grado del vértice.
+    grafo->infoVertices[Grado][indice]++;
+    return false;
 }
 
 /**
@@ -232,14 +757,18 @@ bool FaltanVertices(u32 verticesTotales, u32 verticesIngresados) {
 }
 
 /**
- * @fun: bool AgregaVecinos(Grafo G, datos_t carga, hash_t *hash).
+ * @fun: bool AgregaVecinos(Grafo G, datos_t carga, MapaNombres *mapa,
+ *                          const OpcionesConstruccion *opciones).
  * @param G: estructura Grafo con los vértices cargados.
  * @param carga: estructura datos_t.
- * @param hash: estructura hash_t (tabla hash).
+ * @param mapa: mapa de nombres de los vértices a sus índices.
+ * @param opciones: opciones de construcción; indican qué hacer con los lados
+ * repetidos.
  * @return: devuelve false si los vecinos fueron agregador correctamente; true
  *          si ocurrió un error.
  */
-bool AgregarVecinos(Grafo G, datos_t carga, hash_t *hash) {
+bool AgregarVecinos(Grafo G, datos_t carga, MapaNombres *mapa,
+                    const OpcionesConstruccion *opciones) {
     // Arreglo para almacenar el (grado-1) de cada vertice para
     // saber como almacenarlos en el arreglo de vecinos de cada uno.
     u32 *grados_vertices;
@@ -265,18 +794,35 @@ bool AgregarVecinos(Grafo G, datos_t carga, hash_t *hash) {
         vertice_2 = carga->arreglo_lados[i + 1];
         // Usamos la función CargarVecinos() para agregar que los vértices se
         // agreguen mutuamente como vecinos.
-        error = CargarVecinos(hash, G, grados_vertices, vertice_1, vertice_2);
+        error = CargarVecinos(mapa, G, grados_vertices, vertice_1, vertice_2);
         if (error) return true;
     }
-    // Chequear que en los vertices no haya vecinos repetidos...
-    // Para esto usamos la funcion HayVecinosRepetidos(); si los hay
-    // devolvemos true ya que ocurrio un error.
+    free(grados_vertices);
+    return TratarVecinosRepetidos(G, opciones);
+}
+
+/**
+ * @fun: TratarVecinosRepetidos(Grafo G,
+ *                              const OpcionesConstruccion *opciones).
+ * @param G: estructura Grafo con todos sus vecinos cargados.
+ * @param opciones: opciones de construcción; indican qué hacer con los lados
+ * repetidos.
+ * @return: devuelve true si hay lados repetidos y deben rechazarse, o si
+ * ocurrió un error; false en caso contrario.
+ */
+bool TratarVecinosRepetidos(Grafo G, const OpcionesConstruccion *opciones) {
+    // Según las opciones, los lados repetidos se eliminan...
+    if (opciones->lados_repetidos == EliminarRepetidos) {
+        return EliminarVecinosRepetidos(G);
+    }
+    // ... o se chequea que en los vertices no haya vecinos repetidos usando
+    // la funcion HayVecinosRepetidos(); si los hay devolvemos true ya que
+    // ocurrio un error.
     if (HayVecinosRepetidos(G)) {
-        free(grados_vertices);
+        printf("Hay lados repetidos\n");
         return true;
     }
-    // Si llegamos hasta acá liberamos memoria y devolvemos false.
-    free(grados_vertices);
+    // Si llegamos hasta acá devolvemos false.
     return false;
 }
 
@@ -287,34 +833,50 @@ bool AgregarVecinos(Grafo G, datos_t carga, hash_t *hash) {
  * @param array_grados: un arreglo del tamaño de los vértices existentes en
  * el grafo.
  * @brief: la función registra el grado-1 del vértice  "i" en el array de
- * vértices en lA posición "i" de array_grados y aloca memoria para el arreglo
- * vecinos_v de cada vértice del grafo.
+ * vértices en lA posición "i" de array_grados y aloca memoria para un único
+ * arreglo con los vecinos de todos los vértices, en el que los vecinos de
+ * cada vértice ocupan un tramo consecutivo.
  * @return: true si hubo algún error, false si no lo hubo.
  */
 bool InicializarArregloVecinos(Grafo grafo, u32 array_grados[]) {
+    u32 numVertices = grafo->infoGrafo[Vertices];
+    // Alocamos memoria para los vecinos de todos los vértices, que son dos
+    // por cada lado, y para el comienzo de los vecinos de cada vértice, en
+    // la arena de la topología del grafo.
+    Arena *arena = grafo->topologia->arena;
+    size_t cant_vecinos = 2 * (size_t)grafo->infoGrafo[Lados];
+    grafo->array_vecinos = ArenaAlocar(arena, cant_vecinos * sizeof(u32));
+    grafo->inicio_vecinos = ArenaAlocar(arena, ((size_t)numVertices + 1) *
+                                               sizeof(u32));
+    // Verificamos que se haya asignado memoria.
+    if (grafo->array_vecinos == NULL || grafo->inicio_vecinos == NULL) {
+        return true;
+    }
     // Variable para almacenar el grado de cada vértice.
     u32 grado;
+    // Variable para acumular la cantidad de vecinos de los vértices
+    // anteriores.
+    u32 inicio = 0;
     // Recorriendo el arreglo de vértices del grado...
-    for (u32 i = 0; i < grafo->infoGrafo[Vertices]; ++i){
+    for (u32 i = 0; i < numVertices; ++i){
         // Tomo el grado de un vértice.
-        grado = grafo->array_vertices[i].infoVertice[Grado];
+        grado = grafo->infoVertices[Grado][i];
         // Cargo el arreglo de grados con el grado-1 del vértice en la misma
         // misma posicion "i" que el arreglo de vértices.
         array_grados[i] = grado-1;
-        // Alocamos memoria para para los vecinos de cada vértice.
-        grafo->array_vertices[i].vecinos_v = calloc(grado, sizeof(u32));
-        // Verificamos que se haya asignado memoria.
-        if (grafo->array_vertices[i].vecinos_v == NULL) return true;
+        // Los vecinos del vértice comienzan donde terminan los del anterior.
+        grafo->inicio_vecinos[i] = inicio;
+        inicio += grado;
     }
+    grafo->inicio_vecinos[numVertices] = inicio;
     return false;
 }
 
 /**
- * @fun: CargarVecinos(hash_t* hashTable, Grafo grafo, u32 grados[],
+ * @fun: CargarVecinos(MapaNombres *mapa, Grafo grafo, u32 grados[],
  *                      u32 vertice1, u32 vertice2).
- * @param hashTable: una tabla hash cargada con (clave, dato) donde clave es
- * el nombre del vértice y dato es índice del vértice en el arreglo de la
- * Estructura grafo.
+ * @param mapa: un mapa cargado que asocia el nombre de cada vértice con su
+ * índice en el arreglo de vértices de la estructura grafo.
  * @param grafo: una estructura Grafo ya inicializada con los datos del
  * grafo y los vértices del mismo junto a su grado y sus arreglos de vecinos.
  * @param grados: un arreglo de los grados de los vértices de la estructura
@@ -327,85 +889,96 @@ bool InicializarArregloVecinos(Grafo grafo, u32 array_grados[]) {
  * vecinos.
  * @return: false si no hubo errores, true en caso contrario.
  */
-bool CargarVecinos(hash_t* hashTable, Grafo grafo, u32 grados[], u32 vertice1,
-                   u32 vertice2) {
-    // Variables para obtener las claves de string que se usarán
-    // en el Hash.
-    char *clave_1, *clave_2, *cadena_1, *cadena_2;
-    cadena_1 = malloc(11*sizeof(char));
-    cadena_2 = malloc(11*sizeof(char));
-    if (cadena_1 == NULL || cadena_2 == NULL) return true;
-    // Punteros para obtener los índices de los vértices en el arreglo
-    // de vértices.
-    u32 *Ind_array1, *Ind_array2;
-    // Convertimos los nombres de los vertices en claves de tipo string.
-    clave_1 = itoa_propia(vertice1, cadena_1, 10);
-    clave_2 = itoa_propia(vertice2, cadena_2, 10);
-
-    //Obtenemos los índices de la tabla hash.
-    Ind_array1 = hash_obtener(hashTable, clave_1);
-    Ind_array2 = hash_obtener(hashTable, clave_2);
+bool CargarVecinos(MapaNombres *mapa, Grafo grafo, u32 grados[],
+                   u32 vertice1, u32 vertice2) {
+    //Obtenemos los índices del mapa de nombres.
+    u32 Ind_array1 = ObtenerIndice(mapa, vertice1);
+    u32 Ind_array2 = ObtenerIndice(mapa, vertice2);
+    if (Ind_array1 == HASH_U32_VACIO || Ind_array2 == HASH_U32_VACIO) {
+        return true;
+    }
     // Cargamos los indices en el arreglo de vecinos de cada vértice
     // entrecruzándose. El lugar a donde los colocamos viene dado por el
     // arreglo de grados lo que hace que los coloquemos de atrás para
     // adelante.
-    grafo->array_vertices[*Ind_array1].vecinos_v[grados[*Ind_array1]] =
-            *Ind_array2;
-    grafo->array_vertices[*Ind_array2].vecinos_v[grados[*Ind_array2]] =
-            *Ind_array1;
+    u32 *vecinos = grafo->array_vecinos;
+    vecinos[grafo->inicio_vecinos[Ind_array1] + grados[Ind_array1]] =
+            Ind_array2;
+    vecinos[grafo->inicio_vecinos[Ind_array2] + grados[Ind_array2]] =
+            Ind_array1;
     // Disminuimos los indices para los proximos vecinos.
-    grados[*Ind_array1]--;
-    grados[*Ind_array2]--;
-    // Liberamos la cadenas
-    free(cadena_1);
-    free(cadena_2);
+    grados[Ind_array1]--;
+    grados[Ind_array2]--;
     return false;
 }
 
 /**
  * @fun: HayVecinosRepetidos(Grafo grafo).
  * @param grafo: una estructura grafo con todos sus campos completos.
+ * @brief: recorre una sola vez el arreglo de vecinos marcando en un arreglo
+ * auxiliar, para cada vecino, el índice del último vértice en el que se lo
+ * vio; un vecino ya marcado con el vértice actual está repetido. No modifica
+ * el orden de los vecinos.
  * @return true si algun vértice tiene un vecino repetido en sus arreglo de
- * vecinos, false en caso contrario.
+ * vecinos o si no hubo memoria para el chequeo, false en caso contrario.
  */
 bool HayVecinosRepetidos(Grafo grafo) {
-    // Variable para contar repeteciones.
-    u32 repeticiones;
-    // Para todos los vértices del grafo usando la funcion ContarRepetidos
-    // vemos si en algun caso hay repeticiones en cuyo caso devolvemos true;
-    // sino hay repeticiones entonces devolvemos false.
     u32 numVertices = grafo->infoGrafo[Vertices];
+    // marca[w] guarda el índice del último vértice con w como vecino.
+    u32 *marca = malloc((size_t)numVertices * sizeof(u32));
+    if (marca == NULL) return true;
+    // Todos los bytes en 0xFF dejan cada marca en un índice inexistente.
+    memset(marca, 0xFF, (size_t)numVertices * sizeof(u32));
     for (u32 i = 0; i < numVertices; ++i) {
-        repeticiones = ContarRepetidos(grafo->array_vertices[i].vecinos_v,
-                                       grafo->array_vertices[i]
-                                               .infoVertice[Grado]);
-        if (repeticiones != 0) {
-            return true;
+        for (u32 k = grafo->inicio_vecinos[i];
+             k < grafo->inicio_vecinos[i + 1]; ++k) {
+            u32 vecino = grafo->array_vecinos[k];
+            if (marca[vecino] == i) {
+                free(marca);
+                return true;
+            }
+            marca[vecino] = i;
         }
     }
+    free(marca);
     return false;
 }
 
 /**
- * @fun: contarRepetidos(u32 array[], u32 size).
- * @param array: arreglo de u32.
- * @param size: tamaño del arreglo de u32.
- * @brief: cuenta la cantidad de datos repetidos en un arreglo.
- * @return: la cantidad (u32) de datos repetidos en el arreglo.
+ * @fun: EliminarVecinosRepetidos(Grafo grafo).
+ * @param grafo: una estructura grafo con todos sus vecinos cargados.
+ * @brief: quita los vecinos repetidos de cada vértice usando el mismo arreglo
+ * de marcas que HayVecinosRepetidos(), compactando el arreglo de vecinos en
+ * el lugar y conservando la primera aparición de cada vecino. Actualiza el
+ * grado de cada vértice, el comienzo de sus vecinos y la cantidad de lados.
+ * @return: true si hubo algún error; false en caso contrario.
  */
-u32 ContarRepetidos(u32 array[], u32 size) {
-    // Variable para contar repetidos.
-    u32 n_repetidos = 0;
-    // Ordenamos el arreglo en orden ascendente.
-    qsort(array, size, sizeof(u32), ascendente);
-    for (u32 i = 0; i < (size-1); ++i) {
-        // Si hay dos consecutivos iguales aumentados el contador.
-        if (array[i] == array[i+1]) {
-            n_repetidos++;
+bool EliminarVecinosRepetidos(Grafo grafo) {
+    u32 numVertices = grafo->infoGrafo[Vertices];
+    u32 *marca = malloc((size_t)numVertices * sizeof(u32));
+    if (marca == NULL) return true;
+    memset(marca, 0xFF, (size_t)numVertices * sizeof(u32));
+    // Cantidad de vecinos que quedan en el arreglo hasta el momento; como
+    // nunca supera a la posición de lectura, se puede escribir en el lugar.
+    u32 escritos = 0;
+    for (u32 i = 0; i < numVertices; ++i) {
+        u32 inicio = grafo->inicio_vecinos[i];
+        u32 fin = grafo->inicio_vecinos[i + 1];
+        grafo->inicio_vecinos[i] = escritos;
+        for (u32 k = inicio; k < fin; ++k) {
+            u32 vecino = grafo->array_vecinos[k];
+            if (marca[vecino] != i) {
+                marca[vecino] = i;
+                grafo->array_vecinos[escritos++] = vecino;
+            }
         }
+        grafo->infoVertices[Grado][i] = escritos - grafo->inicio_vecinos[i];
     }
-    // Devolvemos el contador.
-    return n_repetidos;
+    grafo->inicio_vecinos[numVertices] = escritos;
+    // Cada lado aparece en los vecinos de sus dos extremos.
+    grafo->infoGrafo[Lados] = escritos / 2;
+    free(marca);
+    return false;
 }
 
 /**
@@ -462,114 +1035,171 @@ bool InicializarGrafo(Grafo grafo) {
     // Le damos esta cantidad ya que sabemos que Greedy colorea con a lo suma
     // delta granda + 1 colores. Este arreglo nos será util para el reorden
     // chicogrande de bloque de colores.
-    grafo->array_cantidad_colores = calloc(grafo->infoGrafo[DeltaGrande]+1,
-                                         sizeof(u32));
+    grafo->array_cantidad_colores = ArenaAlocarCeros(grafo->arena,
+                                    grafo->infoGrafo[DeltaGrande] + 1,
+                                    sizeof(u32));
     if (grafo->array_cantidad_colores == NULL) return true;
     // Ahora llamamos a greedy para darle un coloreo.
     u32 colores = Greedy(grafo);
     return colores == 0 ? true: false;
 }
 
+/**
+ * @fun: TamanioArenaGrafo(u32 numVertices, u32 delta).
+ * @param numVertices: cantidad de vértices del grafo.
+ * @param delta: grado máximo del grafo, o una cota superior.
+ * @return: bytes a reservar en la arena de un grafo para su estructura, la
+ * información de sus vértices, su orden, su cantidad de colores y, si su
+ * topología está comprimida, los vecinos decodificados de un vértice.
+ */
+size_t TamanioArenaGrafo(u32 numVertices, u32 delta) {
+    return sizeof(GrafoSt) + 4 * (size_t)numVertices * sizeof(u32) +
+           2 * ((size_t)delta + 1) * sizeof(u32) + 8 * ARENA_ALINEACION;
+}
+
+/**
+ * @fun: TamanioArenaTopologia(u32 numVertices, u32 numLados).
+ * @param numVertices: cantidad de vértices del grafo.
+ * @param numLados: cantidad de lados del grafo.
+ * @return: bytes a reservar en la arena de una topología para su estructura
+ * y sus arreglos de vecinos.
+ */
+size_t TamanioArenaTopologia(u32 numVertices, u32 numLados) {
+    return sizeof(TopologiaSt) + ((size_t)numVertices + 1) * sizeof(u32) +
+           2 * (size_t)numLados * sizeof(u32) + 3 * ARENA_ALINEACION;
+}
+
+/**
+ * @fun: CrearTopologia(Grafo G, size_t tam_arena, bool paginas_grandes).
+ * @param G: estructura Grafo sin topología.
+ * @param tam_arena: bytes a reservar para los arreglos de vecinos; 0 si
+ * están en un archivo mapeado.
+ * @param paginas_grandes: si se intenta usar páginas grandes en la arena.
+ * @brief: crea la topología del grafo con una sola referencia, la del grafo,
+ * para que sus copias puedan compartirla. Los arreglos de vecinos se alocan
+ * después en la arena de la topología.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool CrearTopologia(Grafo G, size_t tam_arena, bool paginas_grandes) {
+    Arena *arena = ArenaCrear(sizeof(TopologiaSt) + tam_arena,
+                              paginas_grandes);
+    if (arena == NULL) return true;
+    TopologiaSt *topologia = ArenaAlocarCeros(arena, 1, sizeof(TopologiaSt));
+    topologia->referencias = 1;
+    topologia->arena = arena;
+    G->topologia = topologia;
+    return false;
+}
+
+/**
+ * @fun: LiberarTopologia(Grafo G).
+ * @param G: estructura Grafo.
+ * @brief: quita la referencia del grafo a su topología; si era la última,
+ * libera el archivo mapeado que contiene los arreglos de vecinos, si lo hay,
+ * y la arena de la topología.
+ */
+void LiberarTopologia(Grafo G) {
+    TopologiaSt *topologia = G->topologia;
+    if (topologia != NULL &&
+        __atomic_sub_fetch(&topologia->referencias, 1,
+                           __ATOMIC_ACQ_REL) == 0) {
+        DesmapearTopologia(topologia);
+        // La topología vive en su propia arena.
+        ArenaDestruir(topologia->arena);
+    }
+    G->topologia = NULL;
+    G->array_vecinos = NULL;
+    G->inicio_vecinos = NULL;
+}
+
+/**
+ * @fun: EstadisticasMemoria(Grafo G, EstadisticasArena *propia,
+ *                           EstadisticasArena *topologia).
+ * @param G: un grafo correctamente construido.
+ * @param propia: estructura donde guardar el uso de la arena del grafo.
+ * @param topologia: estructura donde guardar el uso de la arena de la
+ * topología, que es compartida con las copias del grafo. No incluye el
+ * archivo mapeado de un grafo cargado en binario.
+ */
+void EstadisticasMemoria(Grafo G, EstadisticasArena *propia,
+                         EstadisticasArena *topologia) {
+    ArenaEstadisticas(G->arena, propia);
+    ArenaEstadisticas(G->topologia == NULL ? NULL : G->topologia->arena,
+                      topologia);
+}
+
 /**
  * @fun: DestruccionDelGrafo(Grafo G).
  * @param G: estructura Grafo.
  * @brief: Un procedimiento que toma un estructura Grafo y libera la memoria
- *          utilizada por la misma.
+ *          utilizada por la misma, que es su arena y la de su espacio de
+ *          trabajo. La topología sólo se libera si ninguna copia del grafo
+ *          la sigue usando.
  */
 void DestruccionDelGrafo(Grafo G) {
     if (G != NULL) {
-        for (u32 i = 0; i < G->infoGrafo[Vertices]; ++i) {
-            if (G->array_vertices[i].vecinos_v != NULL) {
-                free(G->array_vertices[i].vecinos_v);
-                G->array_vertices[i].vecinos_v = NULL;
-            }
-        }
-        free(G->array_vertices);
-        G->array_vertices = NULL;
-        free(G->array_orden_vertices);
-        G->array_orden_vertices = NULL;
-        free(G->array_cantidad_colores);
-        G->array_cantidad_colores = NULL;
-        free(G);
+        LiberarTopologia(G);
+        DestruirEspacio(G->espacio);
+        // La estructura del grafo está en su arena, así que se libera con
+        // ella.
+        ArenaDestruir(G->arena);
     }
 }
 
 /**
  * @fun: Grafo CopiarGrafo(Grafo G)
  * @param G: un grafo correctamente construido.
+ * @brief: la copia comparte la topología de G, que ninguna función modifica,
+ * y sólo duplica los vértices, el orden y la cantidad de colores, en una
+ * arena propia, por lo que su costo no depende de la cantidad de lados.
  * @return: devuelve un nuevo Grafo igual a G; si hubo errores NULL.
  */
 Grafo CopiarGrafo(Grafo G) {
-    Grafo grafo_copia = NULL;
-    // Se aloca memoria para los elementos del grafo a copiar.
-    grafo_copia = calloc(1, sizeof(GrafoSt));
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 delta = G->infoGrafo[DeltaGrande] + 1;
+    // Se crea la arena de la copia, con lugar para todos sus arreglos, que
+    // toma las páginas grandes de la arena de G.
+    Arena *arena = ArenaCrear(TamanioArenaGrafo(numVertices, delta - 1),
+                              G->arena->paginas_grandes);
     // Se verifica si se asignó memoria.
-    if (grafo_copia == NULL) return NULL;
+    if (arena == NULL) return NULL;
+    // Como la arena tiene lugar para todo, lo que sigue no puede fallar.
+    Grafo grafo_copia = ArenaAlocarCeros(arena, 1, sizeof(GrafoSt));
+    grafo_copia->arena = arena;
 
     // Se copia el nro. de vertices, lados, colores y delta grande de G.
-    grafo_copia->infoGrafo[Vertices] = G->infoGrafo[Vertices];
-    grafo_copia->infoGrafo[Lados] = G->infoGrafo[Lados];
-    grafo_copia->infoGrafo[Colores] = G->infoGrafo[Colores];
-    grafo_copia->infoGrafo[DeltaGrande] = G->infoGrafo[DeltaGrande];
-    
-    // Reservo memoria para el arreglo de estructura de vértices.
-    u32 numVertices = G->infoGrafo[Vertices];
-    grafo_copia->array_vertices = calloc(numVertices, sizeof(VerticeSt));
-    // Verifico la asignación de memoria.
-    if (grafo_copia->array_vertices == NULL) return NULL;
-
-    // Reservo memoria para el array_orden_vertices en grafo_copia.
-    grafo_copia->array_orden_vertices = calloc(numVertices, sizeof(u32));
-
-    // Se verifica que se haya asignado correctamente.
-    if (grafo_copia->array_orden_vertices == NULL) return NULL;
-
-    // Copio la información de cada vertice en G al grafo_copia y el orden en
-    // el arreglo de orden de la copia.
-    for (u32 i=0; i < numVertices; i++) {
-        // Obtenemos e grado de cada vértice.
-        u32 cant_vecinos = G->array_vertices[i].infoVertice[Grado];
-        // Copiamos el Nombre de cada vertice en G.
-        grafo_copia->array_vertices[i].infoVertice[Nombre] = 
-                                       G->array_vertices[i].infoVertice[Nombre];
-        // Copiamos el Grado de cada vertice en G.
-        grafo_copia->array_vertices[i].infoVertice[Grado] = 
-                                        G->array_vertices[i].infoVertice[Grado];
-        // Copiamos el color de cada vertice en G.
-        grafo_copia->array_vertices[i].infoVertice[Color] = 
-                                        G->array_vertices[i].infoVertice[Color];
-        // Reservo memoria para los vecinos de cada vertice en G.
-        grafo_copia->array_vertices[i].vecinos_v = 
-                                              calloc(cant_vecinos, sizeof(u32));
-        // Verificamos la asignación de memoria.
-        if (grafo_copia->array_vertices[i].vecinos_v == NULL) return NULL;
-        // Copiamos el orden por último.
-        grafo_copia->array_orden_vertices[i] = G->array_orden_vertices[i];
-
-    }
-
-    // Copiamos los vecinos de cada vertice en G, al grafo_copia.
-    for (u32 i=0;i < numVertices; i++) {
-        u32 cant_vecinos = G->array_vertices[i].infoVertice[Grado];
-        //Copiamos los vecinos de cada vertice en G.
-        for (u32 j=0;j < cant_vecinos; j++) {
-            grafo_copia->array_vertices[i].vecinos_v[j] =
-                    G->array_vertices[i].vecinos_v[j];
-        }
-    }
+    memcpy(grafo_copia->infoGrafo, G->infoGrafo, sizeof(G->infoGrafo));
 
-    // Reservo memoria para el arreglo de cantidad de colores.
-    grafo_copia->array_cantidad_colores = calloc(G->infoGrafo[DeltaGrande]+1,
-                                                 sizeof(u32));
-    // Se verifica que se haya asignado correctamente.
-    if (grafo_copia->array_cantidad_colores == NULL) return NULL;
+    // Compartimos la topología de G, sumándole una referencia.
+    __atomic_add_fetch(&G->topologia->referencias, 1, __ATOMIC_RELAXED);
+    grafo_copia->topologia = G->topologia;
+    grafo_copia->array_vecinos = G->array_vecinos;
+    grafo_copia->inicio_vecinos = G->inicio_vecinos;
 
-    // delta es la delta grande + 1 que tiene el grafo.
-    u32 delta = grafo_copia->infoGrafo[DeltaGrande]+1;
-    // Copiamos la cantidad de colores de G en grafo copia.
-    for (u32 i = 0; i < delta; i++) {
-        grafo_copia->array_cantidad_colores[i] = G->array_cantidad_colores[i];
+    // Copio la información de cada vertice; como la topología es la misma,
+    // los vecinos de cada vértice siguen en el mismo lugar.
+    for (u32 x = Nombre; x <= Color; x++) {
+        grafo_copia->infoVertices[x] = ArenaAlocar(arena, numVertices *
+                                                          sizeof(u32));
+        memcpy(grafo_copia->infoVertices[x], G->infoVertices[x],
+               numVertices * sizeof(u32));
+    }
+    // Copio el orden y la cantidad de colores.
+    grafo_copia->array_orden_vertices = ArenaAlocar(arena, numVertices *
+                                                           sizeof(u32));
+    memcpy(grafo_copia->array_orden_vertices, G->array_orden_vertices,
+           numVertices * sizeof(u32));
+    grafo_copia->array_cantidad_colores = ArenaAlocar(arena, delta *
+                                                             sizeof(u32));
+    memcpy(grafo_copia->array_cantidad_colores, G->array_cantidad_colores,
+           delta * sizeof(u32));
+    // Si la topología está comprimida, la copia decodifica en su propio
+    // arreglo.
+    if (EstaComprimido(G)) {
+        grafo_copia->vecinos_decodificados = ArenaAlocar(arena, delta *
+                                                                sizeof(u32));
+        grafo_copia->vertice_decodificado = UINT_MAX;
     }
     // Finalmente devolvemos el grafo copiado.
     return grafo_copia;
-}
\ No newline at end of file
+}
@@ -6,18 +6,331 @@
 #ifndef CONSTRUYE_H
 #define CONSTRUYE_H
 
+#include "Arena.h"
+#include "Binario.h"
+#include "Carga.h"
+#include "Comprimido.h"
+#include "Espacio.h"
 #include "Lista.h"
 #include "Hash.h"
 #include "Ordenacion.h"
+#include "Reetiquetado.h"
 #include "U32ToString.h"
 #include "Rii.h"
 
+// Si el rango de nombres de los vértices es a lo sumo este factor por la
+// cantidad de vértices, los nombres se asocian con índices mediante un arreglo
+// indexado por nombre en lugar de una tabla hash.
+#define FACTOR_RANGO_DENSO 4
+
+// Estructura que asocia el nombre de cada vértice con su índice en el
+// arreglo de vértices del grafo.
+typedef struct _MapaNombres_ {
+    // Tabla hash, usada cuando los nombres están dispersos; NULL si se usa
+    // el arreglo directo.
+    hash_u32_t *hash;
+    // Arreglo con el índice del vértice de nombre (nombre_minimo + k) en la
+    // posición k, o HASH_U32_VACIO si no hay tal vértice; NULL si se usa la
+    // tabla hash.
+    u32 *indices;
+    // Menor nombre de vértice del grafo y largo del arreglo directo.
+    u32 nombre_minimo;
+    size_t rango;
+} MapaNombres;
+
+// Qué hacer cuando el grafo de entrada tiene lados repetidos.
+enum LadosRepetidos {RechazarRepetidos, EliminarRepetidos};
+
+// Opciones con las que se construye un grafo.
+typedef struct _OpcionesConstruccion_ {
+    // Cantidad de hilos para leer un archivo; con 1 se lee secuencialmente y
+    // con 0 se usan todos los procesadores.
+    u32 num_hilos;
+    // Si los lados repetidos hacen fallar la construcción o se eliminan,
+    // dejando una sola copia de cada lado.
+    enum LadosRepetidos lados_repetidos;
+    // Si se intenta respaldar las arenas del grafo con páginas grandes.
+    bool paginas_grandes;
+    // Criterio para reasignar los índices de los vértices una vez construido
+    // el grafo, para que los vecinos queden cerca en memoria.
+    enum Reetiquetado reetiquetado;
+    // Si los vecinos se guardan comprimidos; ocupan menos memoria a cambio
+    // de decodificarlos al recorrerlos. Sin reetiquetar se codifican directo
+    // desde los lados, sin armar el arreglo de vecinos completo; si no, se
+    // comprimen después de reetiquetar.
+    bool comprimir_vecinos;
+} OpcionesConstruccion;
+
+// Cantidad mínima de lados por hilo en la construcción paralela; con menos
+// lados no conviene lanzar más hilos.
+#define MINIMO_LADOS_POR_HILO (1u << 16)
+
+// Estructura con el trabajo de cada hilo en la construcción paralela.
+typedef struct _TrozoConstruccion_ {
+    // Grafo en construcción.
+    Grafo grafo;
+    // Arreglo de lados de la carga, con los índices de los vértices.
+    const u32 *lados;
+    // Lados del trozo: desde primer_lado hasta fin_lados sin incluirlo.
+    u32 primer_lado;
+    u32 fin_lados;
+    // Vértices del trozo: desde primer_vertice hasta fin_vertices sin
+    // incluirlo.
+    u32 primer_vertice;
+    u32 fin_vertices;
+    // Histograma de los grados de los vértices en los lados del trozo, que
+    // luego se convierte en los cursores donde el trozo escribe vecinos.
+    u32 *grados;
+    // Todos los trozos, para sumar los histogramas de cada vértice.
+    struct _TrozoConstruccion_ *trozos;
+    u32 num_trozos;
+    // Suma de los grados de los vértices del trozo y, luego de la suma de
+    // prefijos, el comienzo de los vecinos del primer vértice del trozo.
+    u32 suma_grados;
+} TrozoConstruccion;
+
+// La construcción comprimida arma los vecinos sin comprimir de a tramos de
+// vértices, que ocupan a lo sumo esta fracción de todos los vecinos, o
+// MINIMO_VECINOS_POR_TRAMO vecinos o el grado máximo si son más.
+#define FRACCION_TRAMO_COMPRIMIDO 8
+#define MINIMO_VECINOS_POR_TRAMO (1u << 16)
+
+// Estructura con el tramo de vértices que arma la construcción comprimida.
+typedef struct _TramoComprimido_ {
+    // Grafo en construcción.
+    Grafo grafo;
+    // Arreglo de lados de la carga, con los índices de los vértices, y su
+    // cantidad de extremos.
+    const u32 *lados;
+    size_t cant_extremos;
+    // Cantidad de veces que aparece cada vértice en los lados, contando los
+    // lados repetidos.
+    u32 *apariciones;
+    // Posición en vecinos del tramo donde empiezan los vecinos de cada
+    // vértice del tramo.
+    u32 *cursor;
+    // Vecinos sin comprimir de los vértices del tramo, con lugar para
+    // capacidad elementos.
+    u32 *vecinos;
+    size_t capacidad;
+    // Vértices del tramo: desde primer_vertice hasta fin_vertices sin
+    // incluirlo.
+    u32 primer_vertice;
+    u32 fin_vertices;
+} TramoComprimido;
+
+/**
+ * @fun: CrearMapaNombres(MapaNombres *mapa, datos_t carga).
+ * @param mapa: estructura a inicializar.
+ * @param carga: estructura datos_t con los lados y el rango de nombres.
+ * @brief: elige el arreglo directo si los nombres son densos, es decir si
+ * el rango de nombres no supera FACTOR_RANGO_DENSO veces la cantidad de
+ * vértices; si no, usa una tabla hash de enteros. El arreglo sólo tiene
+ * lugar para los nombres del rango de carga.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool CrearMapaNombres(MapaNombres *mapa, datos_t carga);
+
+/**
+ * @fun: ObtenerOGuardarIndice(MapaNombres *mapa, u32 nombre, u32 indice).
+ * @param mapa: un mapa de nombres creado.
+ * @param nombre: nombre de un vértice.
+ * @param indice: índice a asociar con el nombre si todavía no tiene uno.
+ * @return: el índice asociado al nombre; HASH_U32_VACIO si hubo un error o
+ * el nombre está fuera del rango del arreglo directo.
+ */
+u32 ObtenerOGuardarIndice(MapaNombres *mapa, u32 nombre, u32 indice);
+
+/**
+ * @fun: ObtenerIndice(const MapaNombres *mapa, u32 nombre).
+ * @param mapa: un mapa de nombres creado.
+ * @param nombre: nombre de un vértice.
+ * @return: el índice asociado al nombre; HASH_U32_VACIO si no tiene uno.
+ */
+u32 ObtenerIndice(const MapaNombres *mapa, u32 nombre);
+
+/**
+ * @fun: DestruirMapaNombres(MapaNombres *mapa).
+ * @param mapa: un mapa de nombres creado.
+ * @brief: libera la memoria usada por el mapa.
+ */
+void DestruirMapaNombres(MapaNombres *mapa);
+
 /**
- * @fun: CargarVecinos(hash_t* hashTable, Grafo grafo, u32 grados[],
+ * @fun: OpcionesConstruccionPorDefecto(OpcionesConstruccion *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que se construye un grafo cuando no se
+ * indica otra cosa: lectura secuencial, rechazo de los lados repetidos,
+ * páginas de tamaño normal, sin reetiquetar los vértices y sin comprimir
+ * sus vecinos.
+ */
+void OpcionesConstruccionPorDefecto(OpcionesConstruccion *opciones);
+
+/**
+ * @fun: ConstruccionDelGrafoDesdeArchivo(const char *ruta,
+ *                                        const OpcionesConstruccion *opciones).
+ * @param ruta: ruta de un archivo en formato DIMACS.
+ * @param opciones: opciones de construcción, o NULL para usar las opciones
+ * por defecto. Con num_hilos igual a 1 el archivo se lee secuencialmente y
+ * con 0 se usan todos los procesadores.
+ * @return: Devuelve una estructura Grafo con la información del grafo del
+ * archivo, leído mapeándolo en memoria; NULL si hubo errores.
+ */
+Grafo ConstruccionDelGrafoDesdeArchivo(const char *ruta,
+                                       const OpcionesConstruccion *opciones);
+
+/**
+ * @fun: ConstruirGrafoDesdeDatos(datos_t carga_inicial,
+ *                                const OpcionesConstruccion *opciones).
+ * @param carga_inicial: estructura con los lados leídos, o NULL si la lectura
+ * falló. Sus campos nombre_minimo y nombre_maximo tienen que abarcar todos
+ * los nombres de los lados, como los dejan las funciones de Carga.h; si no,
+ * los nombres de afuera se rechazan como error. La estructura se destruye
+ * antes de volver.
+ * @param opciones: opciones de construcción, o NULL para usar las opciones
+ * por defecto.
+ * @return: Devuelve una estructura Grafo construida a partir de los lados de
+ * carga_inicial; NULL si hubo errores.
+ */
+Grafo ConstruirGrafoDesdeDatos(datos_t carga_inicial,
+                               const OpcionesConstruccion *opciones);
+
+/**
+ * @fun: AgregarVerticesYVecinos(MapaNombres *mapa, Grafo grafo,
+ *                               datos_t carga,
+ *                               const OpcionesConstruccion *opciones).
+ * @param mapa: un mapa de nombres creado y vacío.
+ * @param grafo: una estructura grafo con sus arreglos de vértices y de orden
+ * alocados.
+ * @param carga: estructura datos_t con los lados leídos.
+ * @param opciones: opciones de construcción.
+ * @brief: construcción secuencial; agrega los vértices contando sus grados y
+ * luego los vecinos de cada uno.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool AgregarVerticesYVecinos(MapaNombres *mapa, Grafo grafo, datos_t carga,
+                             const OpcionesConstruccion *opciones);
+
+/**
+ * @fun: IndexarLados(MapaNombres *mapa, Grafo grafo, datos_t carga).
+ * @param mapa: un mapa de nombres creado y vacío.
+ * @param grafo: una estructura grafo con su arreglo de vértices alocado.
+ * @param carga: estructura datos_t con los lados leídos.
+ * @brief: primera etapa de la construcción paralela y de la comprimida.
+ * Asigna a cada vértice su índice en el mismo orden que AgregarVertice() y
+ * reemplaza en el arreglo de lados de la carga cada nombre por su índice,
+ * para que las etapas siguientes no tengan que consultar el mapa.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool IndexarLados(MapaNombres *mapa, Grafo grafo, datos_t carga);
+
+/**
+ * @fun: ContarGradosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion.
+ * @brief: cuenta en el histograma propio del trozo cuántas veces aparece cada
+ * vértice en los lados del trozo.
+ * @return: NULL.
+ */
+void *ContarGradosTrozo(void *trozo);
+
+/**
+ * @fun: SumarGradosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion.
+ * @brief: para los vértices del trozo suma los histogramas de todos los
+ * trozos, guarda el grado de cada vértice y la suma de esos grados.
+ * @return: NULL.
+ */
+void *SumarGradosTrozo(void *trozo);
+
+/**
+ * @fun: UbicarVecinosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion cuyo campo
+ * suma_grados tiene el comienzo de los vecinos de su primer vértice.
+ * @brief: para los vértices del trozo fija el comienzo de sus vecinos y
+ * convierte el histograma de cada trozo en un cursor: la posición siguiente
+ * a la última que ese trozo llena. Como la construcción secuencial llena los
+ * vecinos de atrás para adelante, los trozos anteriores quedan al final.
+ * @return: NULL.
+ */
+void *UbicarVecinosTrozo(void *trozo);
+
+/**
+ * @fun: LlenarVecinosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoConstruccion con los cursores
+ * calculados por UbicarVecinosTrozo().
+ * @brief: escribe los vecinos de los lados del trozo en su posición final.
+ * Cada trozo usa sólo sus cursores, por lo que no hace falta sincronizar.
+ * @return: NULL.
+ */
+void *LlenarVecinosTrozo(void *trozo);
+
+/**
+ * @fun: AgregarVecinosParalelo(Grafo G, datos_t carga,
+ *                              const OpcionesConstruccion *opciones).
+ * @param G: estructura Grafo con los nombres de los vértices cargados.
+ * @param carga: estructura datos_t con los lados ya indexados por
+ * IndexarLados().
+ * @param opciones: opciones de construcción; num_hilos indica la cantidad de
+ * hilos y lados_repetidos qué hacer con los lados repetidos.
+ * @brief: como AgregarVecinos() pero en paralelo. Cada hilo cuenta los
+ * grados de un trozo de lados en un histograma propio, una suma de prefijos
+ * por trozos de vértices da el comienzo de los vecinos de cada vértice y
+ * cada hilo escribe los vecinos de sus lados. El resultado es idéntico al de
+ * la construcción secuencial, incluso en el orden de los vecinos.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool AgregarVecinosParalelo(Grafo G, datos_t carga,
+                            const OpcionesConstruccion *opciones);
+
+/**
+ * @fun: UbicarTramo(TramoComprimido *tramo, u32 primero).
+ * @param tramo: estructura con las apariciones de cada vértice y la
+ * capacidad del tramo, que es al menos la mayor de las apariciones.
+ * @param primero: primer vértice del tramo.
+ * @brief: toma desde primero tantos vértices como entren en la capacidad y
+ * pone el cursor de cada uno al final de su lugar, ya que los vecinos se
+ * llenan de atrás para adelante.
+ */
+void UbicarTramo(TramoComprimido *tramo, u32 primero);
+
+/**
+ * @fun: ArmarTramo(TramoComprimido *tramo,
+ *                  enum LadosRepetidos lados_repetidos).
+ * @param tramo: estructura con un tramo ubicado por UbicarTramo().
+ * @param lados_repetidos: qué hacer con los lados repetidos.
+ * @brief: recorre todos los lados llenando los vecinos de los vértices del
+ * tramo, los ordena de menor a mayor, quita los repetidos y guarda el grado
+ * que queda. Al terminar, el cursor de cada vértice es el comienzo de sus
+ * vecinos.
+ * @return: true si hay lados repetidos y deben rechazarse; false en caso
+ * contrario.
+ */
+bool ArmarTramo(TramoComprimido *tramo, enum LadosRepetidos lados_repetidos);
+
+/**
+ * @fun: AgregarVecinosComprimidos(Grafo G, datos_t carga,
+ *                                 const OpcionesConstruccion *opciones).
+ * @param G: estructura Grafo con los nombres de los vértices cargados.
+ * @param carga: estructura datos_t con los lados ya indexados por
+ * IndexarLados().
+ * @param opciones: opciones de construcción; lados_repetidos indica qué
+ * hacer con los lados repetidos.
+ * @brief: como AgregarVecinos() pero codificando los vecinos de cada vértice
+ * directamente en la topología comprimida. Cuenta las apariciones de cada
+ * vértice y arma los vecinos de a tramos con ArmarTramo(): en una primera
+ * pasada para saber cuántos bytes ocupa cada vértice y en otra para
+ * codificarlos. Así nunca se tiene el arreglo de vecinos completo, a cambio
+ * de recorrer los lados dos veces por tramo.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool AgregarVecinosComprimidos(Grafo G, datos_t carga,
+                               const OpcionesConstruccion *opciones);
+
+/**
+ * @fun: CargarVecinos(MapaNombres *mapa, Grafo grafo, u32 grados[],
  *                      u32 vertice1, u32 vertice2).
- * @param hashTable: una tabla hash cargada con (clave, dato) donde clave es
- * el nombre del vértice y dato es índice del vértice en el arreglo de la
- * Estructura grafo.
+ * @param mapa: un mapa cargado que asocia el nombre de cada vértice con su
+ * índice en el arreglo de vértices de la estructura grafo.
  * @param grafo: una estructura Grafo ya inicializada con los datos del
  * grafo y los vértices del mismo junto a su grado y sus arreglos de vecinos.
  * @param grados: un arreglo de los grados de los vértices de la estructura
@@ -30,8 +343,8 @@
  * vecinos.
  * @return: false si no hubo errores, true en caso contrario.
  */
-bool CargarVecinos(hash_t* hashTable, Grafo grafo, u32 grados[], u32 vertice1,
-                   u32 vertice2);
+bool CargarVecinos(MapaNombres *mapa, Grafo grafo, u32 grados[],
+                   u32 vertice1, u32 vertice2);
 
 /**
  * @fun: InicializarArregloVecinos(Grafo grafo, u32 array_grados[]).
@@ -39,9 +352,10 @@ bool CargarVecinos(hash_t* hashTable, Grafo grafo, u32 grados[], u32 vertice1,
  * uno cargados en ella.
  * @param array_grados: un arreglo del tamaño de los vértices existentes en
  * el grafo.
- * @brief: la función registra el grado del vértice "i" en el array de vértices
- * en lA posición "i" de array_grados y aloca memoria para el arreglo vecinos_v
- * de cada vértice del grafo.
+ * @brief: la función registra el grado-1 del vértice "i" en el array de
+ * vértices en lA posición "i" de array_grados y aloca memoria para un único
+ * arreglo con los vecinos de todos los vértices, en el que los vecinos de
+ * cada vértice ocupan un tramo consecutivo.
  * @return: true si hubo algún error, false si no lo hubo.
  */
 bool InicializarArregloVecinos(Grafo grafo, u32 array_grados[]);
@@ -66,27 +380,31 @@ bool InicializarGrafo(Grafo grafo);
 
 
 /**
- * @fun: bool AgregaVecinos(Grafo G, datos_t carga, hash_t *hash).
+ * @fun: bool AgregaVecinos(Grafo G, datos_t carga, MapaNombres *mapa,
+ *                          const OpcionesConstruccion *opciones).
  * @param G: estructura Grafo con los vértices cargados.
  * @param carga: estructura datos_t.
- * @param hash: estructura hash_t (tabla hash).
+ * @param mapa: mapa de nombres de los vértices a sus índices.
+ * @param opciones: opciones de construcción; indican qué hacer con los lados
+ * repetidos.
  * @return: devuelve false si los vecinos fueron agregador correctamente; true
  *          si ocurrió un error.
  */
-bool AgregarVecinos(Grafo G, datos_t carga, hash_t *hash);
+bool AgregarVecinos(Grafo G, datos_t carga, MapaNombres *mapa,
+                    const OpcionesConstruccion *opciones);
 
 /**
- * @fun: AgregarVertice(hash_t *HashTable, Grafo grafo, u32 *VerticesIngresados,
-                        u32 vertice).
- * @param HashTable: una tabla hash creada.
+ * @fun: AgregarVertice(MapaNombres *mapa, Grafo grafo,
+ *                      u32 *VerticesIngresados, u32 vertice).
+ * @param mapa: un mapa de nombres creado.
  * @param grafo: una estructura grafo cuyos vértices no han sido cargados.
  * @param VerticesIngresados: cantidad de vértices ingresados hasta el momento.
  * @param vertice: nombre del vértice a agregar.
  * @return: Devuelve false si el vértice se agregó o contabilizó su grado
  * correctamente; true, en caso de error.
  */
-bool AgregarVertice(hash_t *HashTable, Grafo grafo, u32 *VerticesIngresados,
-                        u32 vertice);
+bool AgregarVertice(MapaNombres *mapa, Grafo grafo,
+                    u32 *VerticesIngresados, u32 vertice);
 
 /**
  * @fun: FaltanVertices(u32 verticesTotales, u32 verticesIngresados).
@@ -98,21 +416,92 @@ bool AgregarVertice(hash_t *HashTable, Grafo grafo, u32 *VerticesIngresados,
  */
 bool FaltanVertices(u32 verticesTotales, u32 verticesIngresados);
 
+/**
+ * @fun: TratarVecinosRepetidos(Grafo G,
+ *                              const OpcionesConstruccion *opciones).
+ * @param G: estructura Grafo con todos sus vecinos cargados.
+ * @param opciones: opciones de construcción; indican qué hacer con los lados
+ * repetidos.
+ * @return: devuelve true si hay lados repetidos y deben rechazarse, o si
+ * ocurrió un error; false en caso contrario.
+ */
+bool TratarVecinosRepetidos(Grafo G, const OpcionesConstruccion *opciones);
+
+/**
+ * @fun: TamanioArenaGrafo(u32 numVertices, u32 delta).
+ * @param numVertices: cantidad de vértices del grafo.
+ * @param delta: grado máximo del grafo, o una cota superior.
+ * @return: bytes a reservar en la arena de un grafo para su estructura, la
+ * información de sus vértices, su orden, su cantidad de colores y, si su
+ * topología está comprimida, los vecinos decodificados de un vértice.
+ */
+size_t TamanioArenaGrafo(u32 numVertices, u32 delta);
+
+/**
+ * @fun: TamanioArenaTopologia(u32 numVertices, u32 numLados).
+ * @param numVertices: cantidad de vértices del grafo.
+ * @param numLados: cantidad de lados del grafo.
+ * @return: bytes a reservar en la arena de una topología para su estructura
+ * y sus arreglos de vecinos.
+ */
+size_t TamanioArenaTopologia(u32 numVertices, u32 numLados);
+
+/**
+ * @fun: CrearTopologia(Grafo G, size_t tam_arena, bool paginas_grandes).
+ * @param G: estructura Grafo sin topología.
+ * @param tam_arena: bytes a reservar para los arreglos de vecinos; 0 si
+ * están en un archivo mapeado.
+ * @param paginas_grandes: si se intenta usar páginas grandes en la arena.
+ * @brief: crea la topología del grafo con una sola referencia, la del grafo,
+ * para que sus copias puedan compartirla. Los arreglos de vecinos se alocan
+ * después en la arena de la topología.
+ * @return: true si hubo algún error; false en caso contrario.
+ */
+bool CrearTopologia(Grafo G, size_t tam_arena, bool paginas_grandes);
+
+/**
+ * @fun: LiberarTopologia(Grafo G).
+ * @param G: estructura Grafo.
+ * @brief: quita la referencia del grafo a su topología; si era la última,
+ * libera el archivo mapeado que contiene los arreglos de vecinos, si lo hay,
+ * y la arena de la topología.
+ */
+void LiberarTopologia(Grafo G);
+
+/**
+ * @fun: EstadisticasMemoria(Grafo G, EstadisticasArena *propia,
+ *                           EstadisticasArena *topologia).
+ * @param G: un grafo correctamente construido.
+ * @param propia: estructura donde guardar el uso de la arena del grafo.
+ * @param topologia: estructura donde guardar el uso de la arena de la
+ * topología, que es compartida con las copias del grafo. No incluye el
+ * archivo mapeado de un grafo cargado en binario.
+ */
+void EstadisticasMemoria(Grafo G, EstadisticasArena *propia,
+                         EstadisticasArena *topologia);
+
 /**
  * @fun: HayVecinosRepetidos(Grafo grafo).
  * @param grafo: una estructura grafo con todos sus campos completos.
+ * @brief: recorre una sola vez el arreglo de vecinos marcando en un arreglo
+ * auxiliar, para cada vecino, el índice del último vértice en el que se lo
+ * vio; un vecino ya marcado con el vértice actual está repetido. No modifica
+ * el orden de los vecinos.
  * @return true si algun vértice tiene un vecino repetido en sus arreglo de
- * vecinos, false en caso contrario.
+ * vecinos o si no hubo memoria para el chequeo, false en caso contrario.
  */
 bool HayVecinosRepetidos(Grafo grafo);
 
 /**
- * @fun: contarRepetidos(u32 array[], u32 size).
- * @param array: arreglo de u32.
- * @param size: tamaño del arreglo de u32.
- * @return: la cantidad (u32) de datos repetidos en el arreglo.
+ * @fun: EliminarVecinosRepetidos(Grafo grafo).
+ * @param grafo: una estructura grafo con todos sus vecinos cargados.
+ * @brief: quita los vecinos repetidos de cada vértice usando el mismo arreglo
+ * de marcas que HayVecinosRepetidos(), compactando el arreglo de vecinos en
+ * el lugar y conservando la primera aparición de cada vecino. Actualiza el
+ * grado de cada vértice, el comienzo de sus vecinos y la cantidad de lados.
+ * @return: true si hubo algún error; false en caso contrario.
  */
-u32 ContarRepetidos(u32 array[], u32 size);
+bool EliminarVecinosRepetidos(Grafo grafo);
 
 /**
  * @fun: ascendente(const void * a, const void * b).
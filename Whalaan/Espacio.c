@@ -0,0 +1,89 @@
+/**
+ * @file: Espacio.c
+ * @brief: implementación del espacio de trabajo de los coloreos y las
+ * ordenaciones.
+ */
+
+#include "Arena.h"
+#include "Espacio.h"
+#include "Ordenacion.h"
+
+/**
+ * @fun: TamanioArenaEspacio(u32 numVertices, u32 delta).
+ * @param numVertices: cantidad de vértices.
+ * @param delta: grado máximo, o una cota superior.
+ * @return: bytes a reservar en la arena de un espacio de trabajo para su
+ * estructura y sus arreglos.
+ */
+size_t TamanioArenaEspacio(u32 numVertices, u32 delta) {
+    return sizeof(EspacioSt) +
+           (size_t)numVertices * (sizeof(Aux_Array) + sizeof(u32)) +
+           ((size_t)delta + 1) * (sizeof(Aux_Array) + 2 * sizeof(u32)) +
+           6 * ARENA_ALINEACION;
+}
+
+/**
+ * @fun: CrearEspacio(u32 numVertices, u32 delta).
+ * @param numVertices: cantidad máxima de vértices de los grafos a usar.
+ * @param delta: delta grande máximo de los grafos a usar.
+ * @return: un espacio de trabajo nuevo; NULL si no hubo memoria.
+ */
+Espacio CrearEspacio(u32 numVertices, u32 delta) {
+    // La cantidad de colores se guarda en un u32.
+    if (delta == UINT_MAX) return NULL;
+    u32 numColores = delta + 1;
+    Arena *arena = ArenaCrear(TamanioArenaEspacio(numVertices, delta), false);
+    if (arena == NULL) return NULL;
+    // Como la arena tiene lugar para todo, lo que sigue no puede fallar.
+    Espacio E = ArenaAlocarCeros(arena, 1, sizeof(EspacioSt));
+    E->arena = arena;
+    E->capacidad_vertices = numVertices;
+    E->capacidad_colores = numColores;
+    // Las marcas empiezan en la generación 0, que ningún vértice usa.
+    E->marcas = ArenaAlocarCeros(arena, numColores, sizeof(u32));
+    E->generacion = 0;
+    E->datos = ArenaAlocar(arena, (size_t)numVertices * sizeof(Aux_Array));
+    E->bloques = ArenaAlocar(arena, (size_t)numColores * sizeof(Aux_Array));
+    E->limites = ArenaAlocar(arena, (size_t)numColores * sizeof(u32));
+    E->cola = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    return E;
+}
+
+/**
+ * @fun: VerificarEspacio(Espacio E, Grafo G).
+ * @param E: un espacio de trabajo, o NULL.
+ * @param G: un grafo correctamente construido.
+ * @return: 1 si E es NULL o sus arreglos no alcanzan para G; 0 en caso
+ * contrario.
+ */
+char VerificarEspacio(Espacio E, Grafo G) {
+    if (E == NULL) return 1;
+    return G->infoGrafo[Vertices] > E->capacidad_vertices ||
+           G->infoGrafo[DeltaGrande] >= E->capacidad_colores;
+}
+
+/**
+ * @fun: EspacioDelGrafo(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: devuelve el espacio de trabajo propio de G, que usan Greedy(), las
+ * ordenaciones y Bipartito(). Se crea en la primera llamada y se destruye
+ * con el grafo; las copias tienen el suyo.
+ * @return: el espacio de trabajo de G; NULL si no hubo memoria.
+ */
+Espacio EspacioDelGrafo(Grafo G) {
+    if (G->espacio == NULL) {
+        G->espacio = CrearEspacio(G->infoGrafo[Vertices],
+                                  G->infoGrafo[DeltaGrande]);
+    }
+    return G->espacio;
+}
+
+/**
+ * @fun: DestruirEspacio(Espacio E).
+ * @param E: un espacio de trabajo, o NULL.
+ * @brief: libera la memoria del espacio de trabajo.
+ */
+void DestruirEspacio(Espacio E) {
+    // La estructura está en su arena, así que se libera con ella.
+    if (E != NULL) ArenaDestruir(E->arena);
+}
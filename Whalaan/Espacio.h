@@ -0,0 +1,83 @@
+/**
+ * @file: Espacio.h
+ * @brief: fichero del espacio de trabajo de los coloreos y las ordenaciones:
+ * todos los arreglos auxiliares que usan Greedy, las ordenaciones y
+ * Bipartito, pedidos una sola vez. Un ciclo que llama a estas funciones con
+ * el mismo espacio no aloca memoria en ninguna iteración.
+ */
+
+#ifndef ESPACIO_H
+#define ESPACIO_H
+
+#include "Rii.h"
+
+// Estructura del espacio de trabajo. Sirve para cualquier grafo de a lo sumo
+// capacidad_vertices vértices y delta grande menor a capacidad_colores, pero
+// no se puede usar desde dos hilos a la vez.
+typedef struct _EspacioSt_ {
+    // Cantidad de vértices y de colores (delta grande + 1) para los que
+    // alcanzan los arreglos.
+    u32 capacidad_vertices;
+    u32 capacidad_colores;
+    // Colores prohibidos de Greedy: para cada color, la generación en la que
+    // se lo prohibió por última vez, y la última generación usada.
+    u32 *marcas;
+    u32 generacion;
+    // Arreglo que ordena OrdenarSegunX(), uno por vértice.
+    struct _Aux_Array_ *datos;
+    // Bloques de colores de RMBCchicogrande(), uno por color, y el límite
+    // superior de cada bloque en el nuevo orden.
+    struct _Aux_Array_ *bloques;
+    u32 *limites;
+    // Cola del BFS de Bipartito(), uno por vértice.
+    u32 *cola;
+    // Arena de la que salen esta estructura y sus arreglos.
+    struct _Arena_ *arena;
+} EspacioSt;
+
+typedef EspacioSt *Espacio;
+
+/**
+ * @fun: TamanioArenaEspacio(u32 numVertices, u32 delta).
+ * @param numVertices: cantidad de vértices.
+ * @param delta: grado máximo, o una cota superior.
+ * @return: bytes a reservar en la arena de un espacio de trabajo para su
+ * estructura y sus arreglos.
+ */
+size_t TamanioArenaEspacio(u32 numVertices, u32 delta);
+
+/**
+ * @fun: CrearEspacio(u32 numVertices, u32 delta).
+ * @param numVertices: cantidad máxima de vértices de los grafos a usar.
+ * @param delta: delta grande máximo de los grafos a usar.
+ * @return: un espacio de trabajo nuevo; NULL si no hubo memoria.
+ */
+Espacio CrearEspacio(u32 numVertices, u32 delta);
+
+/**
+ * @fun: VerificarEspacio(Espacio E, Grafo G).
+ * @param E: un espacio de trabajo, o NULL.
+ * @param G: un grafo correctamente construido.
+ * @return: 1 si E es NULL o sus arreglos no alcanzan para G; 0 en caso
+ * contrario.
+ */
+char VerificarEspacio(Espacio E, Grafo G);
+
+/**
+ * @fun: EspacioDelGrafo(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @brief: devuelve el espacio de trabajo propio de G, que usan Greedy(), las
+ * ordenaciones y Bipartito(). Se crea en la primera llamada y se destruye
+ * con el grafo; las copias tienen el suyo.
+ * @return: el espacio de trabajo de G; NULL si no hubo memoria.
+ */
+Espacio EspacioDelGrafo(Grafo G);
+
+/**
+ * @fun: DestruirEspacio(Espacio E).
+ * @param E: un espacio de trabajo, o NULL.
+ * @brief: libera la memoria del espacio de trabajo.
+ */
+void DestruirEspacio(Espacio E);
+
+#endif // ESPACIO_H
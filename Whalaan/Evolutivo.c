@@ -0,0 +1,279 @@
+/**
+ * @file: Evolutivo.c
+ * @brief: implementación del coloreo evolutivo híbrido.
+ */
+
+#include "Arena.h"
+#include "Evolutivo.h"
+#include "Hilos.h"
+#include "Paralelo.h"
+
+/**
+ * @fun: OpcionesEvolutivoPorDefecto(OpcionesEvolutivo *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que corre ColoreoEvolutivo() cuando no
+ * se indica otra cosa: población de 10, 10000 iteraciones de Tabucol por
+ * hijo, todos los procesadores, 10 segundos, semilla 0 y sin cota
+ * inferior.
+ */
+void OpcionesEvolutivoPorDefecto(OpcionesEvolutivo *opciones) {
+    opciones->tamanio_poblacion = 10;
+    opciones->iteraciones_tabu = 10000;
+    opciones->num_hilos = 0;
+    opciones->max_segundos = 10;
+    opciones->semilla = 0;
+    opciones->cota_inferior = 0;
+}
+
+/**
+ * @fun: CruzarGPX(TrabajadorEvolutivo *trabajador, u32 hijo[]).
+ * @param trabajador: un trabajador con padre y madre con k colores.
+ * @param hijo: donde se guarda el coloreo hijo.
+ * @brief: cruce por particiones de Galinier y Hao: el color i del hijo es la
+ * clase con más vértices sin heredar del padre si i es par, o de la madre si
+ * es impar, y esos vértices se dejan de contar en los dos. Los vértices que
+ * quedan sin heredar se marcan con k, sin color. Cuesta O(n + k^2).
+ */
+void CruzarGPX(TrabajadorEvolutivo *trabajador, u32 hijo[]) {
+    u32 numVertices = trabajador->busqueda->num_vertices;
+    u32 k = trabajador->k;
+    const u32 *padres[2] = {trabajador->padre, trabajador->madre};
+    // Se ordenan los vértices de cada padre por color, contando; restantes
+    // sirve primero de cursor.
+    for (u32 p = 0; p < 2; p++) {
+        u32 *inicio = trabajador->inicio[p];
+        u32 *restantes = trabajador->restantes[p];
+        memset(inicio, 0, ((size_t)k + 1) * sizeof(u32));
+        for (u32 v = 0; v < numVertices; v++) {
+            inicio[padres[p][v] + 1]++;
+        }
+        for (u32 c = 0; c < k; c++) {
+            inicio[c + 1] += inicio[c];
+            restantes[c] = inicio[c];
+        }
+        for (u32 v = 0; v < numVertices; v++) {
+            trabajador->por_color[p][restantes[padres[p][v]]++] = v;
+        }
+        for (u32 c = 0; c < k; c++) {
+            restantes[c] = inicio[c + 1] - inicio[c];
+        }
+    }
+    for (u32 v = 0; v < numVertices; v++) {
+        hijo[v] = k;
+    }
+    for (u32 i = 0; i < k; i++) {
+        u32 p = i % 2;
+        u32 *restantes = trabajador->restantes[p];
+        u32 *restantes_otro = trabajador->restantes[1 - p];
+        const u32 *otro = padres[1 - p];
+        u32 clase = 0;
+        for (u32 c = 1; c < k; c++) {
+            if (restantes[c] > restantes[clase]) clase = c;
+        }
+        if (restantes[clase] == 0) break;
+        const u32 *por_color = trabajador->por_color[p];
+        for (u32 j = trabajador->inicio[p][clase];
+             j < trabajador->inicio[p][clase + 1]; j++) {
+            u32 v = por_color[j];
+            if (hijo[v] != k) continue;
+            hijo[v] = i;
+            restantes_otro[otro[v]]--;
+        }
+        restantes[clase] = 0;
+    }
+}
+
+/**
+ * @fun: MejorarHijo(void *trabajador).
+ * @param trabajador: puntero a una estructura TrabajadorEvolutivo.
+ * @brief: arma el coloreo del trabajador, cruzando sus padres o sacando una
+ * clase del inicial, ubica los vértices sin color con IniciarBusquedaTabu()
+ * y lo mejora con BuscarTabu(). El resultado queda en la búsqueda.
+ * @return: NULL.
+ */
+void *MejorarHijo(void *trabajador) {
+    TrabajadorEvolutivo *t = trabajador;
+    BusquedaTabu *busqueda = t->busqueda;
+    u32 *hijo = busqueda->colores;
+    if (t->padre != NULL) {
+        CruzarGPX(t, hijo);
+    } else {
+        // El inicial tiene k + 1 colores: la clase sacada queda sin color y
+        // el último color ocupa su lugar.
+        for (u32 v = 0; v < busqueda->num_vertices; v++) {
+            u32 color = t->inicial[v];
+            if (color == t->clase) {
+                color = UINT_MAX;
+            } else if (color == t->k) {
+                color = t->clase;
+            }
+            hijo[v] = color;
+        }
+    }
+    IniciarBusquedaTabu(busqueda, t->k, hijo);
+    BuscarTabu(busqueda, t->iteraciones_tabu, t->limite);
+    return NULL;
+}
+
+/**
+ * @fun: ColoreoEvolutivo(Grafo G, const OpcionesEvolutivo *opciones,
+ *                        EstadisticasEvolutivo *estadisticas).
+ * @param G: un grafo correctamente construido con un coloreo propio, como
+ * después de Greedy().
+ * @param opciones: tamaños, presupuesto y semilla, o NULL para usar las
+ * opciones por defecto.
+ * @param estadisticas: donde se guardan los hilos y las generaciones; puede
+ * ser NULL. Se llena siempre, con ceros si no se llega a buscar porque G ya
+ * alcanza la cota inferior o porque hubo un error.
+ * @brief: algoritmo evolutivo híbrido de Galinier y Hao. Si el coloreo de G
+ * tiene k colores, arma una población de coloreos con k - 1 sacándole a G
+ * clases distintas y los mejora con Tabucol. Luego, en cada generación,
+ * cada hilo cruza dos coloreos al azar con CruzarGPX() y mejora el hijo, que
+ * reemplaza al peor de la población si no tiene más conflictos. Los hilos
+ * comparten la topología de G, que sólo se lee. Cuando un coloreo queda
+ * propio pasa a ser el de G y se sigue con un color menos, hasta que se
+ * acaba el tiempo, si está limitado, o se alcanza la cota inferior. Deja en
+ * G el mejor coloreo propio y la cantidad de vértices de cada color, como
+ * Greedy().
+ * @return: el número de colores del coloreo de G; 0 si no hubo memoria o
+ * las tablas de Tabucol pasan de TABU_MAX_CELDAS celdas, y entonces G no
+ * cambia.
+ */
+u32 ColoreoEvolutivo(Grafo G, const OpcionesEvolutivo *opciones,
+                     EstadisticasEvolutivo *estadisticas) {
+    OpcionesEvolutivo por_defecto;
+    if (opciones == NULL) {
+        OpcionesEvolutivoPorDefecto(&por_defecto);
+        opciones = &por_defecto;
+    }
+    if (estadisticas != NULL) {
+        memset(estadisticas, 0, sizeof(EstadisticasEvolutivo));
+    }
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 k = G->infoGrafo[Colores];
+    u32 minimo = opciones->cota_inferior > 1 ? opciones->cota_inferior : 1;
+    if (k <= minimo) return k;
+    // Sin segundos positivos no hay límite, como en Tabucol().
+    double limite = 0;
+    if (opciones->max_segundos > 0) {
+        limite = Segundos() + opciones->max_segundos;
+    }
+    u32 tamanio = opciones->tamanio_poblacion;
+    if (tamanio < 2) tamanio = 2;
+    u32 hilos = opciones->num_hilos;
+    if (hilos == 0) hilos = CantidadDeProcesadores();
+    if (hilos > tamanio / 2) hilos = tamanio / 2;
+    size_t celdas = (size_t)numVertices * tamanio;
+    Arena *arena = ArenaCrear(celdas * sizeof(u32) + (size_t)hilos *
+                              ((size_t)numVertices + k + 1) * 2 *
+                              sizeof(u32), false);
+    if (arena == NULL) return 0;
+    u32 *poblacion = ArenaAlocar(arena, celdas * sizeof(u32));
+    size_t *conflictos = ArenaAlocar(arena, (size_t)tamanio * sizeof(size_t));
+    TrabajadorEvolutivo *trabajadores =
+            ArenaAlocarCeros(arena, hilos, sizeof(TrabajadorEvolutivo));
+    char error = poblacion == NULL || conflictos == NULL ||
+                 trabajadores == NULL;
+    for (u32 w = 0; w < hilos && !error; w++) {
+        TrabajadorEvolutivo *t = &trabajadores[w];
+        t->busqueda = CrearBusquedaTabu(G, k - 1, opciones->semilla + w);
+        t->iteraciones_tabu = opciones->iteraciones_tabu;
+        t->limite = limite;
+        for (u32 p = 0; p < 2; p++) {
+            t->por_color[p] = ArenaAlocar(arena, (size_t)numVertices *
+                                                 sizeof(u32));
+            t->inicio[p] = ArenaAlocar(arena, (size_t)k * sizeof(u32));
+            t->restantes[p] = ArenaAlocar(arena, (size_t)k * sizeof(u32));
+            error = error || t->por_color[p] == NULL ||
+                    t->inicio[p] == NULL || t->restantes[p] == NULL;
+        }
+        error = error || t->busqueda == NULL;
+    }
+    if (error) {
+        for (u32 w = 0; trabajadores != NULL && w < hilos; w++) {
+            DestruirBusquedaTabu(trabajadores[w].busqueda);
+        }
+        ArenaDestruir(arena);
+        return 0;
+    }
+    // Los padres se eligen en el hilo que llama, así que con la misma
+    // semilla y los mismos hilos se obtiene lo mismo.
+    uint64_t aleatorio = ((uint64_t)opciones->semilla << 32) | 0x85EBCA6Bu;
+    u32 generaciones = 0;
+    while (k > minimo && (limite == 0 || Segundos() < limite)) {
+        u32 objetivo = k - 1;
+        // Coloreo propio con objetivo colores encontrado, o UINT_MAX.
+        u32 propio = UINT_MAX;
+        // La población inicial sale del coloreo de G sacando cada vez una
+        // clase distinta.
+        for (u32 i = 0; i < tamanio && propio == UINT_MAX; i += hilos) {
+            u32 lote = tamanio - i < hilos ? tamanio - i : hilos;
+            for (u32 w = 0; w < lote; w++) {
+                trabajadores[w].k = objetivo;
+                trabajadores[w].padre = NULL;
+                trabajadores[w].inicial = colores;
+                trabajadores[w].clase = (i + w) % k;
+            }
+            EjecutarEnHilos(MejorarHijo, trabajadores,
+                            sizeof(TrabajadorEvolutivo), lote);
+            for (u32 w = 0; w < lote; w++) {
+                BusquedaTabu *busqueda = trabajadores[w].busqueda;
+                memcpy(poblacion + (size_t)(i + w) * numVertices,
+                       busqueda->colores, (size_t)numVertices * sizeof(u32));
+                conflictos[i + w] = busqueda->conflictos;
+                if (busqueda->conflictos == 0) propio = i + w;
+            }
+        }
+        while (propio == UINT_MAX &&
+               (limite == 0 || Segundos() < limite)) {
+            for (u32 w = 0; w < hilos; w++) {
+                u32 padre = Aleatorio(&aleatorio) % tamanio;
+                u32 madre = Aleatorio(&aleatorio) % (tamanio - 1);
+                if (madre >= padre) madre++;
+                trabajadores[w].k = objetivo;
+                trabajadores[w].padre = poblacion +
+                                        (size_t)padre * numVertices;
+                trabajadores[w].madre = poblacion +
+                                        (size_t)madre * numVertices;
+            }
+            EjecutarEnHilos(MejorarHijo, trabajadores,
+                            sizeof(TrabajadorEvolutivo), hilos);
+            generaciones++;
+            // Los hijos se comparan recién ahora, cuando ya nadie lee a los
+            // padres.
+            for (u32 w = 0; w < hilos && propio == UINT_MAX; w++) {
+                BusquedaTabu *busqueda = trabajadores[w].busqueda;
+                u32 peor = 0;
+                for (u32 i = 1; i < tamanio; i++) {
+                    if (conflictos[i] > conflictos[peor]) peor = i;
+                }
+                if (busqueda->conflictos > conflictos[peor]) continue;
+                memcpy(poblacion + (size_t)peor * numVertices,
+                       busqueda->colores, (size_t)numVertices * sizeof(u32));
+                conflictos[peor] = busqueda->conflictos;
+                if (busqueda->conflictos == 0) propio = peor;
+            }
+        }
+        if (propio == UINT_MAX) break;
+        u32 *ganador = poblacion + (size_t)propio * numVertices;
+        k = CompactarColores(ganador, numVertices, objetivo,
+                             trabajadores[0].busqueda->cantidad);
+        memcpy(colores, ganador, (size_t)numVertices * sizeof(u32));
+    }
+    if (estadisticas != NULL) {
+        estadisticas->hilos = hilos;
+        estadisticas->generaciones = generaciones;
+        estadisticas->iteraciones = 0;
+        for (u32 w = 0; w < hilos; w++) {
+            estadisticas->iteraciones += trabajadores[w].busqueda->iteraciones;
+        }
+    }
+    for (u32 w = 0; w < hilos; w++) {
+        DestruirBusquedaTabu(trabajadores[w].busqueda);
+    }
+    ArenaDestruir(arena);
+    memset(G->array_cantidad_colores, 0,
+           ((size_t)G->infoGrafo[DeltaGrande] + 1) * sizeof(u32));
+    return ContarColores(G);
+}
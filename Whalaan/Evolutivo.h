@@ -0,0 +1,125 @@
+/**
+ * @file: Evolutivo.h
+ * @brief: fichero del coloreo evolutivo híbrido: una población de coloreos
+ * que se cruzan con GPX y se mejoran con Tabucol en varios hilos.
+ */
+
+#ifndef EVOLUTIVO_H
+#define EVOLUTIVO_H
+
+#include <stdint.h>
+
+#include "Rii.h"
+#include "Tabucol.h"
+
+// Opciones de ColoreoEvolutivo().
+typedef struct _OpcionesEvolutivo_ {
+    // Cantidad de coloreos de la población, al menos 2.
+    u32 tamanio_poblacion;
+    // Iteraciones de Tabucol para mejorar cada coloreo nuevo.
+    u32 iteraciones_tabu;
+    // Cantidad de hilos; 0 para usar todos los procesadores. Nunca se usan
+    // más que la mitad de la población.
+    u32 num_hilos;
+    // Segundos para toda la búsqueda; 0 o menos para no limitarla, y
+    // entonces sólo termina al alcanzar cota_inferior, lo que puede no
+    // pasar nunca si no es el número cromático.
+    double max_segundos;
+    // Semilla de los números aleatorios.
+    u32 semilla;
+    // Cantidad de colores por debajo de la cual se sabe que no hay coloreo,
+    // como el tamaño de una clique; al alcanzarla se termina. 0 si no se
+    // conoce.
+    u32 cota_inferior;
+} OpcionesEvolutivo;
+
+// Estadísticas de una corrida de ColoreoEvolutivo().
+typedef struct _EstadisticasEvolutivo_ {
+    // Hilos con los que se mejoraron los coloreos.
+    u32 hilos;
+    // Generaciones de hijos, sumando todas las cantidades de colores.
+    u32 generaciones;
+    // Iteraciones de Tabucol de todos los hilos.
+    uint64_t iteraciones;
+} EstadisticasEvolutivo;
+
+// Trabajo de cada hilo en una generación: arma un coloreo con k colores y
+// lo mejora con su propia búsqueda tabú. Todos los hilos leen la misma
+// topología y los mismos padres, y cada uno escribe sólo en lo suyo.
+typedef struct _TrabajadorEvolutivo_ {
+    BusquedaTabu *busqueda;
+    u32 k;
+    // Padres a cruzar con GPX; si padre es NULL, el coloreo sale de
+    // inicial sacándole la clase de color clase.
+    const u32 *padre;
+    const u32 *madre;
+    const u32 *inicial;
+    u32 clase;
+    u32 iteraciones_tabu;
+    double limite;
+    // Arreglos de GPX: vértices de cada padre ordenados por color, dónde
+    // empieza cada color y cuántos vértices sin heredar le quedan.
+    u32 *por_color[2];
+    u32 *inicio[2];
+    u32 *restantes[2];
+} TrabajadorEvolutivo;
+
+/**
+ * @fun: OpcionesEvolutivoPorDefecto(OpcionesEvolutivo *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que corre ColoreoEvolutivo() cuando no
+ * se indica otra cosa: población de 10, 10000 iteraciones de Tabucol por
+ * hijo, todos los procesadores, 10 segundos, semilla 0 y sin cota
+ * inferior.
+ */
+void OpcionesEvolutivoPorDefecto(OpcionesEvolutivo *opciones);
+
+/**
+ * @fun: CruzarGPX(TrabajadorEvolutivo *trabajador, u32 hijo[]).
+ * @param trabajador: un trabajador con padre y madre con k colores.
+ * @param hijo: donde se guarda el coloreo hijo.
+ * @brief: cruce por particiones de Galinier y Hao: el color i del hijo es la
+ * clase con más vértices sin heredar del padre si i es par, o de la madre si
+ * es impar, y esos vértices se dejan de contar en los dos. Los vértices que
+ * quedan sin heredar se marcan con k, sin color. Cuesta O(n + k^2).
+ */
+void CruzarGPX(TrabajadorEvolutivo *trabajador, u32 hijo[]);
+
+/**
+ * @fun: MejorarHijo(void *trabajador).
+ * @param trabajador: puntero a una estructura TrabajadorEvolutivo.
+ * @brief: arma el coloreo del trabajador, cruzando sus padres o sacando una
+ * clase del inicial, ubica los vértices sin color con IniciarBusquedaTabu()
+ * y lo mejora con BuscarTabu(). El resultado queda en la búsqueda.
+ * @return: NULL.
+ */
+void *MejorarHijo(void *trabajador);
+
+/**
+ * @fun: ColoreoEvolutivo(Grafo G, const OpcionesEvolutivo *opciones,
+ *                        EstadisticasEvolutivo *estadisticas).
+ * @param G: un grafo correctamente construido con un coloreo propio, como
+ * después de Greedy().
+ * @param opciones: tamaños, presupuesto y semilla, o NULL para usar las
+ * opciones por defecto.
+ * @param estadisticas: donde se guardan los hilos y las generaciones; puede
+ * ser NULL. Se llena siempre, con ceros si no se llega a buscar porque G ya
+ * alcanza la cota inferior o porque hubo un error.
+ * @brief: algoritmo evolutivo híbrido de Galinier y Hao. Si el coloreo de G
+ * tiene k colores, arma una población de coloreos con k - 1 sacándole a G
+ * clases distintas y los mejora con Tabucol. Luego, en cada generación,
+ * cada hilo cruza dos coloreos al azar con CruzarGPX() y mejora el hijo, que
+ * reemplaza al peor de la población si no tiene más conflictos. Los hilos
+ * comparten la topología de G, que sólo se lee. Cuando un coloreo queda
+ * propio pasa a ser el de G y se sigue con un color menos, hasta que se
+ * acaba el tiempo, si está limitado, o se alcanza la cota inferior. Deja en
+ * G el mejor coloreo propio y la cantidad de vértices de cada color, como
+ * Greedy().
+ * @return: el número de colores del coloreo de G; 0 si no hubo memoria o
+ * las tablas de Tabucol pasan de TABU_MAX_CELDAS celdas, y entonces G no
+ * cambia.
+ */
+u32 ColoreoEvolutivo(Grafo G, const OpcionesEvolutivo *opciones,
+                     EstadisticasEvolutivo *estadisticas);
+
+#endif // EVOLUTIVO_H
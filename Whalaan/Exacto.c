@@ -0,0 +1,412 @@
+/**
+ * @file: Exacto.c
+ * @brief: implementación del coloreo exacto.
+ */
+
+#include "Arena.h"
+#include "Clique.h"
+#include "Coloreo.h"
+#include "Comprimido.h"
+#include "Exacto.h"
+#include "Paralelo.h"
+#include "Tabucol.h"
+
+/**
+ * @fun: OpcionesExactoPorDefecto(OpcionesExacto *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que corre ColoreoExacto() cuando no se
+ * indica otra cosa: sin límite de nodos y 10 segundos.
+ */
+void OpcionesExactoPorDefecto(OpcionesExacto *opciones) {
+    opciones->max_nodos = 0;
+    opciones->max_segundos = 10;
+}
+
+/**
+ * @fun: CliqueGreedyDesde(const BusquedaExacta *busqueda, u32 inicio,
+ *                         u32 mejor, u32 clique[]).
+ * @param busqueda: una búsqueda con la matriz de adyacencia.
+ * @param inicio: el primer vértice de la clique.
+ * @param mejor: tamaño de la mejor clique conocida.
+ * @param clique: arreglo de al menos num_vertices elementos donde se guardan
+ * los vértices de la clique.
+ * @brief: arma una clique que empieza en inicio agregando cada vez el
+ * candidato con más vecinos entre los candidatos, que pasan a ser sus
+ * vecinos; cada paso cuenta con popcount sobre los conjuntos en bits. Corta
+ * en cuanto la clique más los candidatos no pasan de mejor.
+ * @return: el tamaño de la clique si es mayor que mejor; 0 si no.
+ */
+u32 CliqueGreedyDesde(const BusquedaExacta *busqueda, u32 inicio,
+                      u32 mejor, u32 clique[]) {
+    u32 palabras = busqueda->palabras;
+    uint64_t *candidatos = busqueda->candidatos;
+    memcpy(candidatos, busqueda->adyacencia + (size_t)inicio * palabras,
+           palabras * sizeof(uint64_t));
+    u32 tamanio = 0;
+    clique[tamanio++] = inicio;
+    for (;;) {
+        u32 elegido = UINT_MAX;
+        u32 max_vecinos = 0;
+        u32 num_candidatos = 0;
+        for (u32 w = 0; w < palabras; w++) {
+            num_candidatos += (u32)__builtin_popcountll(candidatos[w]);
+        }
+        if (tamanio + num_candidatos <= mejor) return 0;
+        for (u32 w = 0; w < palabras; w++) {
+            for (uint64_t bits = candidatos[w]; bits != 0; bits &= bits - 1) {
+                u32 v = w * 64 + (u32)__builtin_ctzll(bits);
+                const uint64_t *fila = busqueda->adyacencia +
+                                       (size_t)v * palabras;
+                u32 vecinos = 0;
+                for (u32 x = 0; x < palabras; x++) {
+                    vecinos += (u32)__builtin_popcountll(fila[x] &
+                                                        candidatos[x]);
+                }
+                if (elegido == UINT_MAX || vecinos > max_vecinos) {
+                    elegido = v;
+                    max_vecinos = vecinos;
+                }
+            }
+        }
+        if (elegido == UINT_MAX) break;
+        clique[tamanio++] = elegido;
+        const uint64_t *fila = busqueda->adyacencia +
+                               (size_t)elegido * palabras;
+        for (u32 w = 0; w < palabras; w++) {
+            candidatos[w] &= fila[w];
+        }
+    }
+    return tamanio;
+}
+
+/**
+ * @fun: ColorearExacto(BusquedaExacta *busqueda, u32 v, u32 color).
+ * @param busqueda: una búsqueda.
+ * @param v: un vértice sin color.
+ * @param color: un color que no tiene ningún vecino de v.
+ * @brief: le da color a v y actualiza lo visto por sus vecinos sin color.
+ */
+void ColorearExacto(BusquedaExacta *busqueda, u32 v, u32 color) {
+    u32 palabras = busqueda->palabras;
+    const uint64_t *fila = busqueda->adyacencia + (size_t)v * palabras;
+    busqueda->colores[v] = color;
+    busqueda->sin_color[v / 64] &= ~((uint64_t)1 << (v % 64));
+    for (u32 w = 0; w < palabras; w++) {
+        for (uint64_t bits = fila[w] & busqueda->sin_color[w]; bits != 0;
+             bits &= bits - 1) {
+            u32 u = w * 64 + (u32)__builtin_ctzll(bits);
+            if (busqueda->vistos[(size_t)u * busqueda->max_colores +
+                                 color]++ == 0) {
+                busqueda->saturacion[u]++;
+                busqueda->colores_vistos[(size_t)u *
+                                         busqueda->palabras_colores +
+                                         color / 64] |=
+                    (uint64_t)1 << (color % 64);
+            }
+        }
+    }
+}
+
+/**
+ * @fun: DescolorearExacto(BusquedaExacta *busqueda, u32 v).
+ * @param busqueda: una búsqueda.
+ * @param v: el último vértice coloreado con ColorearExacto().
+ * @brief: deshace ColorearExacto().
+ */
+void DescolorearExacto(BusquedaExacta *busqueda, u32 v) {
+    u32 palabras = busqueda->palabras;
+    const uint64_t *fila = busqueda->adyacencia + (size_t)v * palabras;
+    u32 color = busqueda->colores[v];
+    // Los vecinos sin color son los mismos que cuando se coloreó v, porque
+    // los coloreados después ya se descolorearon.
+    for (u32 w = 0; w < palabras; w++) {
+        for (uint64_t bits = fila[w] & busqueda->sin_color[w]; bits != 0;
+             bits &= bits - 1) {
+            u32 u = w * 64 + (u32)__builtin_ctzll(bits);
+            if (--busqueda->vistos[(size_t)u * busqueda->max_colores +
+                                   color] == 0) {
+                busqueda->saturacion[u]--;
+                busqueda->colores_vistos[(size_t)u *
+                                         busqueda->palabras_colores +
+                                         color / 64] &=
+                    ~((uint64_t)1 << (color % 64));
+            }
+        }
+    }
+    busqueda->sin_color[v / 64] |= (uint64_t)1 << (v % 64);
+    busqueda->colores[v] = UINT_MAX;
+}
+
+/**
+ * @fun: CotaNodoExacto(BusquedaExacta *busqueda, u32 v).
+ * @param busqueda: una búsqueda con un coloreo parcial.
+ * @param v: un vértice sin color.
+ * @brief: acota por abajo los colores de todo coloreo que extienda el
+ * parcial. Arma con Greedy una clique Q de vértices sin color que empieza en
+ * v, agregando cada vez el candidato que ve más de los colores que ya ven
+ * todos los de Q. Ninguno de esos colores sirve para Q, que necesita además
+ * |Q| colores distintos. Corta en cuanto la cota llega a la del mejor
+ * coloreo o ya no puede llegar.
+ * @return: la cantidad de esos colores más |Q|.
+ */
+u32 CotaNodoExacto(BusquedaExacta *busqueda, u32 v) {
+    u32 palabras = busqueda->palabras;
+    u32 palabras_colores = busqueda->palabras_colores;
+    uint64_t *candidatos = busqueda->candidatos;
+    uint64_t *comunes = busqueda->comunes;
+    const uint64_t *fila = busqueda->adyacencia + (size_t)v * palabras;
+    u32 num_candidatos = 0;
+    for (u32 w = 0; w < palabras; w++) {
+        candidatos[w] = fila[w] & busqueda->sin_color[w];
+        num_candidatos += (u32)__builtin_popcountll(candidatos[w]);
+    }
+    memcpy(comunes, busqueda->colores_vistos + (size_t)v * palabras_colores,
+           palabras_colores * sizeof(uint64_t));
+    u32 tamanio = 1;
+    u32 num_comunes = busqueda->saturacion[v];
+    while (tamanio + num_comunes < busqueda->cota_superior &&
+           tamanio + num_comunes + num_candidatos >=
+           busqueda->cota_superior) {
+        u32 elegido = UINT_MAX;
+        u32 max_comunes = 0;
+        for (u32 w = 0; w < palabras; w++) {
+            for (uint64_t bits = candidatos[w]; bits != 0; bits &= bits - 1) {
+                u32 u = w * 64 + (u32)__builtin_ctzll(bits);
+                const uint64_t *vistos_u = busqueda->colores_vistos +
+                                           (size_t)u * palabras_colores;
+                u32 comunes_u = 0;
+                for (u32 x = 0; x < palabras_colores; x++) {
+                    comunes_u += (u32)__builtin_popcountll(vistos_u[x] &
+                                                          comunes[x]);
+                }
+                if (elegido == UINT_MAX || comunes_u > max_comunes) {
+                    elegido = u;
+                    max_comunes = comunes_u;
+                }
+            }
+        }
+        tamanio++;
+        num_comunes = max_comunes;
+        const uint64_t *vistos_e = busqueda->colores_vistos +
+                                   (size_t)elegido * palabras_colores;
+        for (u32 x = 0; x < palabras_colores; x++) {
+            comunes[x] &= vistos_e[x];
+        }
+        fila = busqueda->adyacencia + (size_t)elegido * palabras;
+        num_candidatos = 0;
+        for (u32 w = 0; w < palabras; w++) {
+            candidatos[w] &= fila[w];
+            num_candidatos += (u32)__builtin_popcountll(candidatos[w]);
+        }
+    }
+    return tamanio + num_comunes;
+}
+
+/**
+ * @fun: ElegirVerticeExacto(const BusquedaExacta *busqueda).
+ * @param busqueda: una búsqueda con algún vértice sin color.
+ * @return: el vértice sin color con más colores distintos entre sus vecinos
+ * y, entre ellos, el de mayor grado.
+ */
+u32 ElegirVerticeExacto(const BusquedaExacta *busqueda) {
+    u32 elegido = UINT_MAX;
+    for (u32 w = 0; w < busqueda->palabras; w++) {
+        for (uint64_t bits = busqueda->sin_color[w]; bits != 0;
+             bits &= bits - 1) {
+            u32 v = w * 64 + (u32)__builtin_ctzll(bits);
+            if (elegido == UINT_MAX ||
+                busqueda->saturacion[v] > busqueda->saturacion[elegido] ||
+                (busqueda->saturacion[v] == busqueda->saturacion[elegido] &&
+                 busqueda->grados[v] > busqueda->grados[elegido])) {
+                elegido = v;
+            }
+        }
+    }
+    return elegido;
+}
+
+/**
+ * @fun: ColoreoExacto(Grafo G, const OpcionesExacto *opciones,
+ *                     ResultadoExacto *resultado).
+ * @param G: un grafo correctamente construido con a lo sumo
+ * EXACTO_MAX_VERTICES vértices.
+ * @param opciones: límites de la búsqueda, o NULL para usar las opciones
+ * por defecto.
+ * @param resultado: donde se guardan las cotas y los nodos; puede ser NULL.
+ * @brief: busca el número cromático de G. El primer coloreo sale de
+ * Dsatur() y la cota inferior de CotaInferiorClique(). Los vértices de la
+ * clique se colorean primero con colores distintos, lo que saca simetrías;
+ * luego se ramifica sobre el vértice de ElegirVerticeExacto() con cada
+ * color que no tiene ningún vecino, y con uno nuevo, mientras se pueda
+ * mejorar el mejor coloreo. Antes de bajar a un nodo se descarta si
+ * CotaNodoExacto() ya no deja mejorarlo. Termina cuando el mejor coloreo
+ * alcanza a la clique, cuando se recorre todo el árbol o al llegar a un
+ * límite. Deja en G el mejor coloreo y la cantidad de vértices de cada
+ * color, como Greedy().
+ * Las cotas de los nodos sólo podan: si se corta antes de terminar, la cota
+ * inferior que se informa es la clique del comienzo. En grafos cuyo número
+ * cromático está lejos de su clique máxima, como los aleatorios de unos
+ * cientos de vértices, el árbol es demasiado grande para recorrerlo y sólo
+ * queda un rango entre las dos cotas.
+ * @return: el número de colores del coloreo de G, que es el número cromático
+ * si resultado->optimo; 0 si no hubo memoria o G tiene más de
+ * EXACTO_MAX_VERTICES vértices.
+ */
+u32 ColoreoExacto(Grafo G, const OpcionesExacto *opciones,
+                  ResultadoExacto *resultado) {
+    OpcionesExacto por_defecto;
+    if (opciones == NULL) {
+        OpcionesExactoPorDefecto(&por_defecto);
+        opciones = &por_defecto;
+    }
+    if (resultado != NULL) {
+        memset(resultado, 0, sizeof(ResultadoExacto));
+    }
+    u32 numVertices = G->infoGrafo[Vertices];
+    if (numVertices > EXACTO_MAX_VERTICES) return 0;
+    double limite = 0;
+    if (opciones->max_segundos > 0) {
+        limite = Segundos() + opciones->max_segundos;
+    }
+    u32 cota_superior = Dsatur(G);
+    if (cota_superior == 0) return 0;
+    u32 palabras = (numVertices + 63) / 64;
+    u32 palabras_colores = (cota_superior + 63) / 64;
+    size_t celdas = (size_t)numVertices * cota_superior;
+    Arena *arena = ArenaCrear((((size_t)numVertices + 2) * palabras +
+                               ((size_t)numVertices + 1) * palabras_colores) *
+                              sizeof(uint64_t) + celdas * sizeof(uint16_t) +
+                              (size_t)numVertices * 8 * sizeof(u32), false);
+    if (arena == NULL) return 0;
+    BusquedaExacta busqueda;
+    busqueda.num_vertices = numVertices;
+    busqueda.palabras = palabras;
+    busqueda.max_colores = cota_superior;
+    busqueda.cota_superior = cota_superior;
+    busqueda.adyacencia = ArenaAlocarCeros(arena, (size_t)numVertices *
+                                                  palabras, sizeof(uint64_t));
+    busqueda.sin_color = ArenaAlocarCeros(arena, palabras, sizeof(uint64_t));
+    busqueda.candidatos = ArenaAlocar(arena, palabras * sizeof(uint64_t));
+    busqueda.colores = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    busqueda.vistos = ArenaAlocarCeros(arena, celdas, sizeof(uint16_t));
+    busqueda.palabras_colores = palabras_colores;
+    busqueda.colores_vistos = ArenaAlocarCeros(arena, (size_t)numVertices *
+                                               palabras_colores,
+                                               sizeof(uint64_t));
+    busqueda.comunes = ArenaAlocar(arena, palabras_colores *
+                                          sizeof(uint64_t));
+    busqueda.saturacion = ArenaAlocarCeros(arena, numVertices, sizeof(u32));
+    busqueda.grados = G->infoVertices[Grado];
+    busqueda.mejor = G->infoVertices[Color];
+    u32 *clique = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    // Pila de la búsqueda: vértice de cada nivel, último color que se le
+    // probó y colores usados antes de colorearlo.
+    u32 *pila_vertice = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    u32 *pila_color = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    u32 *pila_usados = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    if (busqueda.adyacencia == NULL || busqueda.sin_color == NULL ||
+        busqueda.candidatos == NULL || busqueda.colores == NULL ||
+        busqueda.vistos == NULL || busqueda.colores_vistos == NULL ||
+        busqueda.comunes == NULL || busqueda.saturacion == NULL ||
+        clique == NULL || pila_vertice == NULL || pila_color == NULL ||
+        pila_usados == NULL) {
+        ArenaDestruir(arena);
+        return 0;
+    }
+    for (u32 v = 0; v < numVertices; v++) {
+        const u32 *vecinos_v = VecinosEnCache(G, v);
+        uint64_t *fila = busqueda.adyacencia + (size_t)v * palabras;
+        for (u32 j = 0; j < busqueda.grados[v]; j++) {
+            fila[vecinos_v[j] / 64] |= (uint64_t)1 << (vecinos_v[j] % 64);
+        }
+        busqueda.sin_color[v / 64] |= (uint64_t)1 << (v % 64);
+        busqueda.colores[v] = UINT_MAX;
+    }
+    u32 cota_inferior = CotaInferiorClique(G, clique);
+    if (cota_inferior == 0) {
+        ArenaDestruir(arena);
+        return 0;
+    }
+    uint64_t nodos = 0;
+    bool cortado = false;
+    if (cota_inferior < busqueda.cota_superior) {
+        for (u32 i = 0; i < cota_inferior; i++) {
+            ColorearExacto(&busqueda, clique[i], i);
+        }
+        u32 restantes = numVertices - cota_inferior;
+        u32 tope = 0;
+        if (restantes > 0) {
+            pila_vertice[0] = ElegirVerticeExacto(&busqueda);
+            pila_color[0] = UINT_MAX;
+            pila_usados[0] = cota_inferior;
+            if (CotaNodoExacto(&busqueda, pila_vertice[0]) <
+                busqueda.cota_superior) {
+                tope = 1;
+            }
+        }
+        while (tope > 0) {
+            u32 v = pila_vertice[tope - 1];
+            u32 usados = pila_usados[tope - 1];
+            u32 color = 0;
+            if (pila_color[tope - 1] != UINT_MAX) {
+                color = pila_color[tope - 1] + 1;
+                DescolorearExacto(&busqueda, v);
+                restantes++;
+            }
+            // Sólo sirven los colores que dejan menos que el mejor coloreo:
+            // los ya usados y, si alcanza, uno nuevo.
+            u32 max_color = busqueda.cota_superior - 2;
+            if (usados < max_color) max_color = usados;
+            const uint16_t *vistos_v = busqueda.vistos +
+                                       (size_t)v * busqueda.max_colores;
+            while (color <= max_color && vistos_v[color] != 0) {
+                color++;
+            }
+            if (color > max_color) {
+                tope--;
+                continue;
+            }
+            nodos++;
+            if ((opciones->max_nodos != 0 && nodos > opciones->max_nodos) ||
+                (limite > 0 && nodos % EXACTO_NODOS_RELOJ == 0 &&
+                 Segundos() >= limite)) {
+                cortado = true;
+                break;
+            }
+            ColorearExacto(&busqueda, v, color);
+            pila_color[tope - 1] = color;
+            restantes--;
+            if (color + 1 > usados) usados = color + 1;
+            if (restantes == 0) {
+                // Coloreo completo con menos colores que el mejor: como los
+                // colores se usan en orden, son de 0 a usados - 1.
+                busqueda.cota_superior = usados;
+                memcpy(busqueda.mejor, busqueda.colores,
+                       (size_t)numVertices * sizeof(u32));
+                if (usados == cota_inferior) break;
+            } else {
+                // Si la cota del nodo no deja mejorar, se prueba el próximo
+                // color de v sin bajar.
+                u32 siguiente = ElegirVerticeExacto(&busqueda);
+                if (CotaNodoExacto(&busqueda, siguiente) <
+                    busqueda.cota_superior) {
+                    pila_vertice[tope] = siguiente;
+                    pila_color[tope] = UINT_MAX;
+                    pila_usados[tope] = usados;
+                    tope++;
+                }
+            }
+        }
+    }
+    ArenaDestruir(arena);
+    if (resultado != NULL) {
+        resultado->cota_inferior = cortado ? cota_inferior
+                                           : busqueda.cota_superior;
+        resultado->cota_superior = busqueda.cota_superior;
+        resultado->nodos = nodos;
+        resultado->optimo = !cortado;
+    }
+    memset(G->array_cantidad_colores, 0,
+           ((size_t)G->infoGrafo[DeltaGrande] + 1) * sizeof(u32));
+    return ContarColores(G);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file: Exacto.h
+ * @brief: fichero del coloreo exacto: ramificación y acotación con la regla
+ * de DSATUR sobre la matriz de adyacencia en bits, para grafos de hasta
+ * unos miles de vértices.
+ */
+
+#ifndef EXACTO_H
+#define EXACTO_H
+
+#include <stdint.h>
+
+#include "Rii.h"
+
+// Máximo de vértices para el coloreo exacto: la matriz de adyacencia ocupa
+// vértices^2 bits, 8 MB con este máximo.
+#define EXACTO_MAX_VERTICES 8192
+
+// Cada cuántos nodos se mira el reloj.
+#define EXACTO_NODOS_RELOJ 4096
+
+// Opciones de ColoreoExacto().
+typedef struct _OpcionesExacto_ {
+    // Máximo de nodos del árbol de búsqueda; 0 para no limitarlos.
+    uint64_t max_nodos;
+    // Segundos para la búsqueda; 0 para no limitarla.
+    double max_segundos;
+} OpcionesExacto;
+
+// Resultado de ColoreoExacto().
+typedef struct _ResultadoExacto_ {
+    // Tamaño de la clique encontrada, que acota el número cromático por
+    // abajo, y colores del mejor coloreo, que lo acota por arriba.
+    u32 cota_inferior;
+    u32 cota_superior;
+    // Nodos del árbol de búsqueda recorridos.
+    uint64_t nodos;
+    // Si la búsqueda terminó, y entonces la cota superior es el número
+    // cromático.
+    bool optimo;
+} ResultadoExacto;
+
+// Estado de la búsqueda exacta.
+typedef struct _BusquedaExacta_ {
+    u32 num_vertices;
+    // Palabras de cada fila de la matriz de adyacencia y de cada conjunto.
+    u32 palabras;
+    // Fila v de la matriz: los vecinos de v.
+    uint64_t *adyacencia;
+    // Vértices sin color, y un conjunto auxiliar para armar las cliques.
+    uint64_t *sin_color;
+    uint64_t *candidatos;
+    // Color de cada vértice en el coloreo parcial; UINT_MAX si no tiene.
+    u32 *colores;
+    // vistos[v * max_colores + c]: vecinos de v con color c; con menos de
+    // EXACTO_MAX_VERTICES vértices entra en 16 bits.
+    uint16_t *vistos;
+    u32 max_colores;
+    // Los mismos colores vistos en bits: la fila de v tiene el bit c si v
+    // tiene algún vecino con color c. Cada fila tiene palabras_colores
+    // palabras.
+    uint64_t *colores_vistos;
+    u32 palabras_colores;
+    // Colores que ven todos los vértices de la clique de CotaNodoExacto().
+    uint64_t *comunes;
+    // Cantidad de colores distintos entre los vecinos de cada vértice.
+    u32 *saturacion;
+    u32 *grados;
+    // Mejor coloreo encontrado y su cantidad de colores.
+    u32 *mejor;
+    u32 cota_superior;
+} BusquedaExacta;
+
+/**
+ * @fun: OpcionesExactoPorDefecto(OpcionesExacto *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que corre ColoreoExacto() cuando no se
+ * indica otra cosa: sin límite de nodos y 10 segundos.
+ */
+void OpcionesExactoPorDefecto(OpcionesExacto *opciones);
+
+/**
+ * @fun: CliqueGreedyDesde(const BusquedaExacta *busqueda, u32 inicio,
+ *                         u32 mejor, u32 clique[]).
+ * @param busqueda: una búsqueda con la matriz de adyacencia.
+ * @param inicio: el primer vértice de la clique.
+ * @param mejor: tamaño de la mejor clique conocida.
+ * @param clique: arreglo de al menos num_vertices elementos donde se guardan
+ * los vértices de la clique.
+ * @brief: arma una clique que empieza en inicio agregando cada vez el
+ * candidato con más vecinos entre los candidatos, que pasan a ser sus
+ * vecinos; cada paso cuenta con popcount sobre los conjuntos en bits. Corta
+ * en cuanto la clique más los candidatos no pasan de mejor.
+ * @return: el tamaño de la clique si es mayor que mejor; 0 si no.
+ */
+u32 CliqueGreedyDesde(const BusquedaExacta *busqueda, u32 inicio,
+                      u32 mejor, u32 clique[]);
+
+/**
+ * @fun: ColorearExacto(BusquedaExacta *busqueda, u32 v, u32 color).
+ * @param busqueda: una búsqueda.
+ * @param v: un vértice sin color.
+ * @param color: un color que no tiene ningún vecino de v.
+ * @brief: le da color a v y actualiza lo visto por sus vecinos sin color.
+ */
+void ColorearExacto(BusquedaExacta *busqueda, u32 v, u32 color);
+
+/**
+ * @fun: DescolorearExacto(BusquedaExacta *busqueda, u32 v).
+ * @param busqueda: una búsqueda.
+ * @param v: el último vértice coloreado con ColorearExacto().
+ * @brief: deshace ColorearExacto().
+ */
+void DescolorearExacto(BusquedaExacta *busqueda, u32 v);
+
+/**
+ * @fun: CotaNodoExacto(BusquedaExacta *busqueda, u32 v).
+ * @param busqueda: una búsqueda con un coloreo parcial.
+ * @param v: un vértice sin color.
+ * @brief: acota por abajo los colores de todo coloreo que extienda el
+ * parcial. Arma con Greedy una clique Q de vértices sin color que empieza en
+ * v, agregando cada vez el candidato que ve más de los colores que ya ven
+ * todos los de Q. Ninguno de esos colores sirve para Q, que necesita además
+ * |Q| colores distintos. Corta en cuanto la cota llega a la del mejor
+ * coloreo o ya no puede llegar.
+ * @return: la cantidad de esos colores más |Q|.
+ */
+u32 CotaNodoExacto(BusquedaExacta *busqueda, u32 v);
+
+/**
+ * @fun: ElegirVerticeExacto(const BusquedaExacta *busqueda).
+ * @param busqueda: una búsqueda con algún vértice sin color.
+ * @return: el vértice sin color con más colores distintos entre sus vecinos
+ * y, entre ellos, el de mayor grado.
+ */
+u32 ElegirVerticeExacto(const BusquedaExacta *busqueda);
+
+/**
+ * @fun: ColoreoExacto(Grafo G, const OpcionesExacto *opciones,
+ *                     ResultadoExacto *resultado).
+ * @param G: un grafo correctamente construido con a lo sumo
+ * EXACTO_MAX_VERTICES vértices.
+ * @param opciones: límites de la búsqueda, o NULL para usar las opciones
+ * por defecto.
+ * @param resultado: donde se guardan las cotas y los nodos; puede ser NULL.
+ * @brief: busca el número cromático de G. El primer coloreo sale de
+ * Dsatur() y la cota inferior de CotaInferiorClique(). Los vértices de la
+ * clique se colorean primero con colores distintos, lo que saca simetrías;
+ * luego se ramifica sobre el vértice de ElegirVerticeExacto() con cada
+ * color que no tiene ningún vecino, y con uno nuevo, mientras se pueda
+ * mejorar el mejor coloreo. Antes de bajar a un nodo se descarta si
+ * CotaNodoExacto() ya no deja mejorarlo. Termina cuando el mejor coloreo
+ * alcanza a la clique, cuando se recorre todo el árbol o al llegar a un
+ * límite. Deja en G el mejor coloreo y la cantidad de vértices de cada
+ * color, como Greedy().
+ * Las cotas de los nodos sólo podan: si se corta antes de terminar, la cota
+ * inferior que se informa es la clique del comienzo. En grafos cuyo número
+ * cromático está lejos de su clique máxima, como los aleatorios de unos
+ * cientos de vértices, el árbol es demasiado grande para recorrerlo y sólo
+ * queda un rango entre las dos cotas.
+ * @return: el número de colores del coloreo de G, que es el número cromático
+ * si resultado->optimo; 0 si no hubo memoria o G tiene más de
+ * EXACTO_MAX_VERTICES vértices.
+ */
+u32 ColoreoExacto(Grafo G, const OpcionesExacto *opciones,
+                  ResultadoExacto *resultado);
+
+#endif // EXACTO_H
@@ -333,3 +333,134 @@ void hash_iter_destruir(hash_iter_t* iter){
 		free(iter);
 	}
 }
+
+/******************************************************************************
+ *               Tabla Hash de enteros (direccionamiento abierto)
+ *****************************************************************************/
+
+#define TAM_INICIAL_U32 16
+
+// Entrada de la tabla; el dato HASH_U32_VACIO indica una posición libre.
+typedef struct entrada_u32 {
+	unsigned int clave;
+	unsigned int dato;
+} entrada_u32_t;
+
+struct hash_u32 {
+	entrada_u32_t *tabla;
+	size_t cantidad;
+	// La capacidad es siempre potencia de dos, así la posición se obtiene
+	// con una máscara en lugar del módulo.
+	size_t capacidad;
+};
+
+// Función de hashing: mezcla final de MurmurHash3, que distribuye en los bits
+// bajos tanto claves consecutivas como claves que difieren en los bits altos.
+size_t fhash_u32(unsigned int clave, size_t capacidad) {
+	unsigned int hash = clave;
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+	return (size_t)hash & (capacidad - 1);
+}
+
+// Devuelve la posición de la clave en la tabla, o la posición libre donde
+// debería guardarse.
+size_t posicion_u32(const hash_u32_t *hash, unsigned int clave) {
+	size_t pos = fhash_u32(clave, hash->capacidad);
+	while (hash->tabla[pos].dato != HASH_U32_VACIO &&
+	       hash->tabla[pos].clave != clave) {
+		pos = (pos + 1) & (hash->capacidad - 1);
+	}
+	return pos;
+}
+
+// Pide una tabla de la capacidad dada con todas sus posiciones libres.
+entrada_u32_t *tabla_u32_crear(size_t capacidad) {
+	entrada_u32_t *tabla = malloc(capacidad * sizeof(entrada_u32_t));
+	// Todos los bytes en 0xFF dejan el dato en HASH_U32_VACIO.
+	if (tabla) memset(tabla, 0xFF, capacidad * sizeof(entrada_u32_t));
+	return tabla;
+}
+
+// Duplica la capacidad de la tabla y vuelve a ubicar sus entradas.
+bool hash_u32_redimensionar(hash_u32_t *hash) {
+	entrada_u32_t *anterior = hash->tabla;
+	size_t capacidad_anterior = hash->capacidad;
+	entrada_u32_t *nueva = tabla_u32_crear(capacidad_anterior * 2);
+	if (!nueva) return false;
+	hash->tabla = nueva;
+	hash->capacidad = capacidad_anterior * 2;
+	for (size_t i = 0; i < capacidad_anterior; i++) {
+		if (anterior[i].dato != HASH_U32_VACIO) {
+			hash->tabla[posicion_u32(hash, anterior[i].clave)] = anterior[i];
+		}
+	}
+	free(anterior);
+	return true;
+}
+
+// Crea el hash con lugar para al menos cantidad_esperada elementos sin
+// redimensionar. Devuelve NULL si no se pudo pedir memoria.
+hash_u32_t *hash_u32_crear(size_t cantidad_esperada) {
+	hash_u32_t *hash = malloc(sizeof(hash_u32_t));
+	if (!hash) return NULL;
+	// Mantenemos el factor de carga por debajo de 1/2.
+	size_t capacidad = TAM_INICIAL_U32;
+	while (capacidad < cantidad_esperada * 2) capacidad *= 2;
+	hash->tabla = tabla_u32_crear(capacidad);
+	if (!hash->tabla) {
+		free(hash);
+		return NULL;
+	}
+	hash->cantidad = 0;
+	hash->capacidad = capacidad;
+	return hash;
+}
+
+// Si la clave se encuentra devuelve su dato; si no, guarda (clave, dato) y
+// devuelve dato. Hace una sola búsqueda. Devuelve HASH_U32_VACIO si no se
+// pudo guardar.
+unsigned int hash_u32_obtener_o_guardar(hash_u32_t *hash, unsigned int clave,
+                                        unsigned int dato) {
+	size_t pos = posicion_u32(hash, clave);
+	if (hash->tabla[pos].dato != HASH_U32_VACIO) return hash->tabla[pos].dato;
+	// Redimensiono si al agregar se supera el factor de carga de 1/2.
+	if ((hash->cantidad + 1) * 2 > hash->capacidad) {
+		if (!hash_u32_redimensionar(hash)) return HASH_U32_VACIO;
+		pos = posicion_u32(hash, clave);
+	}
+	hash->tabla[pos].clave = clave;
+	hash->tabla[pos].dato = dato;
+	hash->cantidad++;
+	return dato;
+}
+
+// Guarda el par (clave, dato); si la clave ya se encuentra reemplaza el dato.
+// De no poder guardarlo devuelve false.
+bool hash_u32_guardar(hash_u32_t *hash, unsigned int clave, unsigned int dato) {
+	if (hash_u32_obtener_o_guardar(hash, clave, dato) == HASH_U32_VACIO) {
+		return false;
+	}
+	hash->tabla[posicion_u32(hash, clave)].dato = dato;
+	return true;
+}
+
+// Obtiene el dato de la clave; si no se encuentra devuelve HASH_U32_VACIO.
+unsigned int hash_u32_obtener(const hash_u32_t *hash, unsigned int clave) {
+	return hash->tabla[posicion_u32(hash, clave)].dato;
+}
+
+// Devuelve la cantidad de elementos del hash.
+size_t hash_u32_cantidad(const hash_u32_t *hash) {
+	return hash->cantidad;
+}
+
+// Destruye la estructura liberando la memoria pedida.
+void hash_u32_destruir(hash_u32_t *hash) {
+	if (!hash) return;
+	free(hash->tabla);
+	free(hash);
+}
@@ -83,4 +83,47 @@ bool hash_iter_al_final(const hash_iter_t *iter);
 // Destruye iterador
 void hash_iter_destruir(hash_iter_t* iter);
 
+/******************************************************************************
+ *            Primitivas de Tabla Hash de enteros (direccionamiento abierto)
+ *
+ * Tabla de claves y datos enteros sin signo de 32 bits, con sondeo lineal y
+ * capacidad potencia de dos. Las entradas se guardan en un único arreglo, sin
+ * pedir memoria por cada elemento. El dato HASH_U32_VACIO está reservado.
+ *****************************************************************************/
+
+#define HASH_U32_VACIO 0xFFFFFFFFu
+
+struct hash_u32;
+
+typedef struct hash_u32 hash_u32_t;
+
+// Crea el hash con lugar para al menos cantidad_esperada elementos sin
+// redimensionar. Devuelve NULL si no se pudo pedir memoria.
+hash_u32_t *hash_u32_crear(size_t cantidad_esperada);
+
+// Guarda el par (clave, dato); si la clave ya se encuentra reemplaza el dato.
+// De no poder guardarlo devuelve false.
+// Pre: La estructura hash fue inicializada y dato != HASH_U32_VACIO.
+bool hash_u32_guardar(hash_u32_t *hash, unsigned int clave, unsigned int dato);
+
+// Obtiene el dato de la clave; si no se encuentra devuelve HASH_U32_VACIO.
+// Pre: La estructura hash fue inicializada.
+unsigned int hash_u32_obtener(const hash_u32_t *hash, unsigned int clave);
+
+// Si la clave se encuentra devuelve su dato; si no, guarda (clave, dato) y
+// devuelve dato. Hace una sola búsqueda. Devuelve HASH_U32_VACIO si no se
+// pudo guardar.
+// Pre: La estructura hash fue inicializada y dato != HASH_U32_VACIO.
+unsigned int hash_u32_obtener_o_guardar(hash_u32_t *hash, unsigned int clave,
+                                        unsigned int dato);
+
+// Devuelve la cantidad de elementos del hash.
+// Pre: La estructura hash fue inicializada
+size_t hash_u32_cantidad(const hash_u32_t *hash);
+
+// Destruye la estructura liberando la memoria pedida.
+// Pre: La estructura hash fue inicializada
+// Post: La estructura hash fue destruida
+void hash_u32_destruir(hash_u32_t *hash);
+
 #endif // HASH_H
@@ -0,0 +1,49 @@
+/**
+ * @file: Hilos.c
+ * @brief: implementación de las funciones para repartir trabajo entre
+ * varios hilos.
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+#include "Hilos.h"
+
+/**
+ * @fun: CantidadDeProcesadores().
+ * @return: la cantidad de procesadores disponibles, al menos 1.
+ */
+u32 CantidadDeProcesadores() {
+    long procesadores = sysconf(_SC_NPROCESSORS_ONLN);
+    return procesadores < 1 ? 1 : (u32)procesadores;
+}
+
+/**
+ * @fun: EjecutarEnHilos(void *(*tarea)(void *), void *trabajos,
+ *                       size_t tam_trabajo, u32 num_hilos).
+ * @param tarea: función a correr sobre cada trabajo.
+ * @param trabajos: arreglo de num_hilos estructuras de trabajo.
+ * @param tam_trabajo: tamaño en bytes de cada estructura de trabajo.
+ * @param num_hilos: cantidad de trabajos.
+ * @brief: corre tarea sobre cada trabajo en un hilo propio y espera a que
+ * terminen todos. El primer trabajo, y los de los hilos que no se pudieron
+ * crear, se procesan en el hilo que llama.
+ */
+void EjecutarEnHilos(void *(*tarea)(void *), void *trabajos,
+                     size_t tam_trabajo, u32 num_hilos) {
+    char *trabajo = trabajos;
+    pthread_t *hilos = calloc(num_hilos, sizeof(pthread_t));
+    bool *lanzado = calloc(num_hilos, sizeof(bool));
+    bool hay_hilos = hilos != NULL && lanzado != NULL;
+    for (u32 k = 1; k < num_hilos && hay_hilos; k++) {
+        lanzado[k] = pthread_create(&hilos[k], NULL, tarea,
+                                    trabajo + k * tam_trabajo) == 0;
+    }
+    for (u32 k = 0; k < num_hilos; k++) {
+        if (!hay_hilos || !lanzado[k]) tarea(trabajo + k * tam_trabajo);
+    }
+    for (u32 k = 1; k < num_hilos && hay_hilos; k++) {
+        if (lanzado[k]) pthread_join(hilos[k], NULL);
+    }
+    free(hilos);
+    free(lanzado);
+}
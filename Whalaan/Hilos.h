@@ -0,0 +1,32 @@
+/**
+ * @file: Hilos.h
+ * @brief: fichero de las funciones auxiliares para repartir trabajo entre
+ * varios hilos.
+ */
+
+#ifndef HILOS_H
+#define HILOS_H
+
+#include "Rii.h"
+
+/**
+ * @fun: CantidadDeProcesadores().
+ * @return: la cantidad de procesadores disponibles, al menos 1.
+ */
+u32 CantidadDeProcesadores();
+
+/**
+ * @fun: EjecutarEnHilos(void *(*tarea)(void *), void *trabajos,
+ *                       size_t tam_trabajo, u32 num_hilos).
+ * @param tarea: función a correr sobre cada trabajo.
+ * @param trabajos: arreglo de num_hilos estructuras de trabajo.
+ * @param tam_trabajo: tamaño en bytes de cada estructura de trabajo.
+ * @param num_hilos: cantidad de trabajos.
+ * @brief: corre tarea sobre cada trabajo en un hilo propio y espera a que
+ * terminen todos. El primer trabajo, y los de los hilos que no se pudieron
+ * crear, se procesan en el hilo que llama.
+ */
+void EjecutarEnHilos(void *(*tarea)(void *), void *trabajos,
+                     size_t tam_trabajo, u32 num_hilos);
+
+#endif // HILOS_H
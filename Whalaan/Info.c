@@ -4,6 +4,7 @@
  * información del grafo.
  */
 
+#include "Comprimido.h"
 #include "Rii.h"
 
 /**
@@ -68,7 +69,7 @@ u32 XDelVertice(enum InfoVertice x, Grafo G, u32 i) {
     if (indice_i >= num_vertices) {
             return max_color;
     }
-    return G->array_vertices[indice_i].infoVertice[x];
+    return G->infoVertices[x][indice_i];
 }
 
 /**
@@ -124,24 +125,20 @@ u32 XJotaesimoVecino(enum InfoVertice x, Grafo G, u32 i, u32 j) {
     // en el caso de que si podria, seria inmanejable su utilización. 
     u32 max_color = (2^32) - 1;
     // Comprobación si el indice_i cae fuera del array_orden_vertices, y si j  
-    // cae fuera del arreglo de vecinos_v. en caso de que si no es posible que 
-    // el vertice en orden i tenga un vecino j...
+    // cae fuera de los vecinos del vértice. en caso de que si no es posible
+    // que el vertice en orden i tenga un vecino j...
     if (((indice_i >= num_vertices) || (j >= GradoDelVertice(G, i))) 
                                                     && (x == Grado)) {
         // Devolvemos cero.
         return max_color;
         // En caso contrario...
     } else {
-        VerticeSt vertice_i, vertice_j;
-        // Obtenemos el vértice que se corresponde con el indice_i.
-        vertice_i = G->array_vertices[indice_i];
-        // Obtenemos el índice del vecino número j del vértice anterior.
-        u32 ind_j = vertice_i.vecinos_v[j];
-        // Obtenemos el vértice que se corresponde con el índice anterior, y
-        // por ende con el vertice vecino j.
-        vertice_j = G->array_vertices[ind_j];
-        // Finalmente obtenemos el color del vértice anterior.
-        return vertice_j.infoVertice[x];
+        // Obtenemos el índice del vecino número j del vértice indice_i; si
+        // los vecinos están comprimidos se decodifican una vez por vértice.
+        u32 ind_j = VecinosEnCache(G, indice_i)[j];
+        // Finalmente obtenemos el dato x del vértice con el índice anterior,
+        // y por ende del vertice vecino j.
+        return G->infoVertices[x][ind_j];
     }
 }
 
@@ -11,14 +11,14 @@
 
 /**
  * @fun: DescendenteGrado(const void * a, const void * b).
- * @param a: puntero a void.
- * @param b: puntero a void.
+ * @param a: puntero a una estructura Aux_Array.
+ * @param b: puntero a una estructura Aux_Array.
  * @return: devuelve 0 si los campos datoVertice de referenciados por a y b son
  * iguales; -1 si a > b, y 1 si b > a.
  */
 int DescendenteDato(const void * a, const void * b) {
-    u32 primero = ((*(Aux_Array_t *)a)->datoVertice);
-    u32 segundo = ((*(Aux_Array_t *)b)->datoVertice);
+    u32 primero = ((const Aux_Array *)a)->datoVertice;
+    u32 segundo = ((const Aux_Array *)b)->datoVertice;
     if (primero > segundo) {
         return -1;
     } else if (primero < segundo) {
@@ -30,14 +30,14 @@ int DescendenteDato(const void * a, const void * b) {
 
 /**
  * @fun: AscendenteNombre(const void * a, const void * b)
- * @param a: puntero a void.
- * @param b: puntero a void.
+ * @param a: puntero a una estructura Aux_Array.
+ * @param b: puntero a una estructura Aux_Array.
  * @return: devuelve 0 si los campos datoVertice de referenciados por a y b son
  * iguales; 1 si a > b, y -1 si b > a.
  */
 int AscendenteDato(const void * a, const void * b) {
-    u32 primero = ((*(Aux_Array_t*)a)->datoVertice);
-    u32 segundo = ((*(Aux_Array_t*)b)->datoVertice);
+    u32 primero = ((const Aux_Array *)a)->datoVertice;
+    u32 segundo = ((const Aux_Array *)b)->datoVertice;
     if (primero > segundo) {
         return 1;
     } else if (primero < segundo) {
@@ -54,65 +54,59 @@ typedef int (*FuncionesComparacion)(const void *, const void *);
 const FuncionesComparacion funCompares[2] = {AscendenteDato, DescendenteDato};
 
 /**
- * @fun: GenerarNuevoOrden(Grafo G, Aux_Array_t  *array).
+ * @fun: GenerarNuevoOrden(Grafo G, const Aux_Array array[]).
  * @param G: una estructura grafo inicializada.
  * @param array: un arreglo de estructuras Aux_Array.
  * @brief: un procedimiento que copia en array_orden_vértices del
- * grafo un nuevo orden dado por array y libera la memoria ocupada por cada
- * estructura luego de la copia.
+ * grafo un nuevo orden dado por los índices de array.
  */
-void GenerarNuevoOrden(Grafo G, Aux_Array_t  *array) {
+void GenerarNuevoOrden(Grafo G, const Aux_Array array[]) {
     for (u32 i = 0; i < G->infoGrafo[Vertices]; i++) {
-        G->array_orden_vertices[i] = array[i]->indice;
-        free(array[i]);
+        G->array_orden_vertices[i] = array[i].indice;
     }
 }
 
 /**
- * @fun: GuardarIndice_DatoVertice(Grafo grafo, Aux_Array_t *array, enum
+ * @fun: GuardarIndice_DatoVertice(Grafo grafo, Aux_Array array[], enum
         InfoVertice x).
  * @param grafo: una estructura Grafo.
- * @param array: un arreglo de estructuras Aux_Array.
+ * @param array: un arreglo de estructuras Aux_Array, uno por vértice.
  * @param x: la información de un vértice.
  * @brief: es una función que almacena la información del vértice
- * solicitada junto a su posición en array_vertices de la estructura grafo en
+ * solicitada junto a su índice en la estructura grafo en
  * un arreglo de estructuras Aux_Array. La posicion se almacena en el campo
  * índice de la estructura y el dato en el campo datoVertice.
- * @return: retorna 1 si hubo errores; 0 en caso contrario.
  */
-char GuardarIndice_DatoVertice(Grafo grafo, Aux_Array_t *array, enum
+void GuardarIndice_DatoVertice(Grafo grafo, Aux_Array array[], enum
         InfoVertice x) {
     for (u32 i = 0; i < grafo->infoGrafo[Vertices]; i++) {
-        array[i] = malloc(sizeof(Aux_Array));
-        if (array[i] == NULL) return 1;
-        array[i]->indice = i;
-        array[i]->datoVertice = grafo->array_vertices[i].infoVertice[x];
+        array[i].indice = i;
+        array[i].datoVertice = grafo->infoVertices[x][i];
     }
-    return 0;
 }
 
 /**
- * @fun: OrdenarSegunX(enum InfoVertice x, Grafo G);
+ * @fun: OrdenarSegunXConEspacio(enum InfoVertice info, enum ModoOrden modo,
+ *                               Grafo G, Espacio E).
  * @param info: la información de un vértice.
  * @param modo: el modo en que se va a ordenar.
  * @param G: una estructura Grafo correctamente creada.
- * @brief: es una función que modifica el orden que el grafo según el
- * parámetro x y modo ingresado.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como OrdenarSegunX(), pero ordenando en el arreglo de E, sin alocar
+ * memoria.
  * @return: retorna 1 si hubo errores; 0 en caso contrario.
  */
-char OrdenarSegunX(enum InfoVertice info, enum ModoOrden modo, Grafo G) {
+char OrdenarSegunXConEspacio(enum InfoVertice info, enum ModoOrden modo,
+                             Grafo G, Espacio E) {
     //si el grafo G es vacio termina.
     if (G == NULL) return 1;
-    // Se aloja memoria para el arreglo de estructuras Aux_Array.
-    Aux_Array_t *array = malloc(G->infoGrafo[Vertices]*sizeof(Aux_Array_t));
-    // Verificamos que se haya alojado memoria correctamente.
-    if (array == NULL) return 1;
+    // Verificamos que el arreglo del espacio de trabajo alcance.
+    if (VerificarEspacio(E, G)) return 1;
+    Aux_Array *array = E->datos;
     // Usamos la función GuardarIndice_DatoVertice() para almacenar en el
     // arreglo la información de los vertices que necesitemos y la posición en
     // que estos se encuentren.
-    char error = GuardarIndice_DatoVertice(G, array, info);
-    // Si la función devolvió un error entonces devolvemos 1
-    if (error) return 1;
+    GuardarIndice_DatoVertice(G, array, info);
     // Seleccionamos la función de comparacion para qsort() basándonos en el
     // parámetro info y modo de la siguiente forma: se toma modulo 2 del
     // parámetro info de forma que siempre de 0 o 1; luego el modo que puede
@@ -125,16 +119,29 @@ char OrdenarSegunX(enum InfoVertice info, enum ModoOrden modo, Grafo G) {
     //             Color(=0)     Invertido(=1)  1 -> DescendenteDato
     // Por lo tanto elegimos la función de comparación esta forma:
     bool numCompare = (info%2) + modo;
-    qsort(array, G->infoGrafo[Vertices], sizeof(Aux_Array_t),
+    qsort(array, G->infoGrafo[Vertices], sizeof(Aux_Array),
           funCompares[numCompare]);
     // Usamos la funcion GenerarNuevoOrden() para dar el nuevo orden al grafo.
     GenerarNuevoOrden(G,array);
-    // Liberamos la memoria del arreglo.
-    free(array);
     // Sino se reportaron errores entonces devolvemos 0.
     return 0;
 }
 
+/**
+ * @fun: OrdenarSegunX(enum InfoVertice x, Grafo G);
+ * @param info: la información de un vértice.
+ * @param modo: el modo en que se va a ordenar.
+ * @param G: una estructura Grafo correctamente creada.
+ * @brief: es una función que modifica el orden que el grafo según el
+ * parámetro x y modo ingresado, usando el espacio de trabajo de G.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenarSegunX(enum InfoVertice info, enum ModoOrden modo, Grafo G) {
+    //si el grafo G es vacio termina.
+    if (G == NULL) return 1;
+    return OrdenarSegunXConEspacio(info, modo, G, EspacioDelGrafo(G));
+}
+
 /**
  * @fun: OrdenNatural(Grafo G).
  * @param G: una estructura Grafo.
@@ -146,6 +153,17 @@ char OrdenNatural(Grafo G) {
     return OrdenarSegunX(Nombre, Normal, G);
 }
 
+/**
+ * @fun: OrdenNaturalConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como OrdenNatural(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenNaturalConEspacio(Grafo G, Espacio E) {
+    return OrdenarSegunXConEspacio(Nombre, Normal, G, E);
+}
+
 /**
  * @fun: OrdenWelshPowell(Grafo G).
  * @param G: una estructura Grafo.
@@ -157,6 +175,17 @@ char OrdenWelshPowell(Grafo G) {
     return OrdenarSegunX(Grado, Normal, G);
 }
 
+/**
+ * @fun: OrdenWelshPowellConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como OrdenWelshPowell(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenWelshPowellConEspacio(Grafo G, Espacio E) {
+    return OrdenarSegunXConEspacio(Grado, Normal, G, E);
+}
+
 /**
  * @fun: RMBCnormal(Grafo G).
  * @param G: una estructura Grafo.
@@ -169,6 +198,17 @@ char RMBCnormal(Grafo G) {
     return OrdenarSegunX(Color, Normal, G);
 }
 
+/**
+ * @fun: RMBCnormalConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como RMBCnormal(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char RMBCnormalConEspacio(Grafo G, Espacio E) {
+    return OrdenarSegunXConEspacio(Color, Normal, G, E);
+}
+
 /**
  * @fun: RMBCrevierte(Grafo G).
  * @param G: una estructura Grafo.
@@ -182,108 +222,95 @@ char RMBCrevierte(Grafo G) {
     return OrdenarSegunX(Color, Invertido, G);
 }
 
+/**
+ * @fun: RMBCrevierteConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como RMBCrevierte(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char RMBCrevierteConEspacio(Grafo G, Espacio E) {
+    return OrdenarSegunXConEspacio(Color, Invertido, G, E);
+}
+
 /**
  * @fun: GuardarBloqueColores(Grafo G, u32 cantidadColores,
- *                                    Aux_Array_t *array)
+ *                                    Aux_Array array[])
  * @param G: una estructura grafo correctamente construida.
  * @param cantidadColores: la cantidad de colores del grafo.
- * @param array: un arreglo de estrucutras Aux_Array.
+ * @param array: un arreglo de estrucutras Aux_Array, uno por color.
  * @brief: es una función que almacena un color y la cantidad de vértices de
  * ese color. El color se almacena en el campo índice de la estructura y la
  * cantidad de vértices de ese color en el campo datoVertice.
- * @return: devuelte 1 si ocurrió algun error; 0 en caso contrario.
  */
-char GuardarBloqueColores(Grafo G, u32 cantidadColores, Aux_Array_t *array) {
+void GuardarBloqueColores(Grafo G, u32 cantidadColores, Aux_Array array[]) {
     // Cargamos el arreglo de estructuras Aux_Array de la siguiente forma...
     for (u32 i = 0; i < cantidadColores; ++i) {
-        array[i] = malloc(sizeof(Aux_Array));
-        // Verificamos si se asignó memoria.
-        if (array[i] == NULL) return 1;
         // Como dato se guarda la cantidad de vertices con color i que tiene
         // el grafo...
-        array[i]->datoVertice = G->array_cantidad_colores[i];
+        array[i].datoVertice = G->array_cantidad_colores[i];
         // En el índice asociamos el color i a esta cantidad.
-        array[i]->indice = i;
+        array[i].indice = i;
     }
-    // Sino hubo errores devolvemos cero.
-    return 0;
-}
-
-/**
- * @fun: LiberarBloqueColores(u32 cantColores, Aux_Array_t *bloques).
- * @param cantColores: cantidad de colores del grafo.
- * @param bloques: un arreglo de estructuras Aux_Array.
- * @brief: libera la memoria asignada a bloques.
- */
-void LiberarBloqueColores(u32 cantColores, Aux_Array_t *bloques) {
-    for(u32 i =0; i < cantColores; i++) {
-        free(bloques[i]);
-    }
-    free(bloques);
 }
 
 /**
- * @fun: RMBCchicogrande(Grafo G).
+ * @fun: RMBCchicograndeConEspacio(Grafo G, Espacio E).
  * @param G: una estructura Grafo.
- * @brief: Si G esta coloreado con r colores y VC1 son los vértices coloreados
- * con 1, VC2 los coloreados con 2, etc, entonces esta función ordena los
- * vértices poniendo primero los vértices de VCj1 , luego los de VCj2 ,
- * etc, donde j1, j2,..., jr son tales que |VCj1| ≤ |VCj2| ≤ ... ≤ |VCjr| ,
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como RMBCchicogrande(), usando los arreglos de E.
  * @return: Retorna 0 si no hubo errores, 1 si hubo algún problema.
  */
-char RMBCchicogrande(Grafo G) {
+char RMBCchicograndeConEspacio(Grafo G, Espacio E) {
     // Variable que guarda el número de colores del grafo.
     u32 numColores = G->infoGrafo[Colores];
-    // Se aloja memoria para un arreglo de estructuras Aux_Array del tamaño
-    // de los colores del grafo en ese momento.
-    Aux_Array_t *bloquesColores = malloc(numColores*sizeof(Aux_Array_t));
-    // Verificamos que se haya asignado memoria.
-    if (bloquesColores == NULL) return 1;
+    // Verificamos que los arreglos del espacio de trabajo alcancen; los
+    // bloques de colores tienen lugar para delta grande + 1 colores.
+    if (VerificarEspacio(E, G) || numColores > E->capacidad_colores) return 1;
+    // Sin colores no hay bloques que ordenar.
+    if (numColores == 0) return 0;
+    // Arreglo de estructuras Aux_Array del tamaño de los colores del grafo en
+    // ese momento.
+    Aux_Array *bloquesColores = E->bloques;
 
     // Llamamos a la función GuardarBloqueColores para llenar el
     // arreglo con los colores y sus cantidades...
-    char error = GuardarBloqueColores(G,numColores,bloquesColores);
-    // Si hubo un error, devolvemos 1.
-    if (error) return 1;
+    GuardarBloqueColores(G,numColores,bloquesColores);
 
     // Ordenamos el arreglo de estructuras de menor a mayor por cantidad de
     // colores.
-    qsort(bloquesColores, numColores, sizeof(Aux_Array_t), AscendenteDato);
+    qsort(bloquesColores, numColores, sizeof(Aux_Array), AscendenteDato);
 
-    // Creamos un arreglo para guardar los límites superiores de los índices de
+    // Arreglo para guardar los límites superiores de los índices de
     // los bloques de colores. Los índices del arreglo representarán los
     // diferentes colores; así en el índice 0 tendremos el límite superior
     // del color 0 y así...
-    u32 *array_indices = calloc(numColores,sizeof(u32));
-    // Verificamos que se haya asignado memoria.
-    if (array_indices == NULL) return 1;
+    u32 *array_indices = E->limites;
 
     // Establecemos el límite superior del primer bloque de color, como la
     // cantidad de colores del mismo menos 1.
-    array_indices[bloquesColores[0]->indice] = bloquesColores[0]->datoVertice
-                                               - 1;
+    array_indices[bloquesColores[0].indice] = bloquesColores[0].datoVertice
+                                              - 1;
     // Establecemos la variable verticesAcumulados como la cantidad de colores
     // del primer bloque. A medida que iteremos sobre los diferentes bloques
     // iremos sumándole la cantidad de colores del bloque actual para luego
     // restarle 1 y obtener el límite superior del bloque en cuestión.
-    u32 verticesAcumulados = bloquesColores[0]->datoVertice;
+    u32 verticesAcumulados = bloquesColores[0].datoVertice;
     // Iteramos sobre los bloques de colores...
     for (u32 k = 1; k < numColores; ++k){
         // Actualizamos la cantidad de vértices acumulados
-        verticesAcumulados += bloquesColores[k]->datoVertice;
+        verticesAcumulados += bloquesColores[k].datoVertice;
         // Establecemos el limite superior de ese bloque como la cantidad de
         // vértices acumualdos menos 1.
-        array_indices[bloquesColores[k]->indice] = verticesAcumulados - 1;
+        array_indices[bloquesColores[k].indice] = verticesAcumulados - 1;
     }
-    // Destruimos el arreglo de bloques de colores.
-    LiberarBloqueColores(numColores, bloquesColores);
     // Variable para guardar el color de un vértice.
     u32 color_i;
     // Ahora iteramos sobre todos los vértices para establecer el nuevo orden...
     u32 numVertices = G->infoGrafo[Vertices];
     for (u32 i = 0; i < numVertices; ++i){
         // Guardamos el color del vértice
-        color_i = G->array_vertices[i].infoVertice[Color];
+        color_i = G->infoVertices[Color][i];
         // Accedemos al límite superior para ese color en el arreglo de
         // índices y nos posicionamos en ese límite en el arreglo de orden y
         // establecemos el índice i en ese lugar.
@@ -292,11 +319,22 @@ char RMBCchicogrande(Grafo G) {
         // de índices.
         array_indices[color_i]--;
     }
-    // Liberamos memoria
-    free(array_indices);
     return 0;
 }
 
+/**
+ * @fun: RMBCchicogrande(Grafo G).
+ * @param G: una estructura Grafo.
+ * @brief: Si G esta coloreado con r colores y VC1 son los vértices coloreados
+ * con 1, VC2 los coloreados con 2, etc, entonces esta función ordena los
+ * vértices poniendo primero los vértices de VCj1 , luego los de VCj2 ,
+ * etc, donde j1, j2,..., jr son tales que |VCj1| ≤ |VCj2| ≤ ... ≤ |VCjr| ,
+ * @return: Retorna 0 si no hubo errores, 1 si hubo algún problema.
+ */
+char RMBCchicogrande(Grafo G) {
+    return RMBCchicograndeConEspacio(G, EspacioDelGrafo(G));
+}
+
 /**
  * @fun: char switchVertices(Grafo G, u32 i, u32 j);
  * @param G: una estructura Grafo.
@@ -353,17 +391,17 @@ char SwitchColores(Grafo G, u32 i, u32 j) {
     u32 numVertices = NumeroDeVertices(G);
     for (u32 k= 0; k < numVertices; k++) {
         // Obteniendo el color del vértice...
-        color_k = G->array_vertices[k].infoVertice[Color];
+        color_k = G->infoVertices[Color][k];
         // Si el vertice tenia color i...
         if (color_k == i) {
             // Lo establecemos con color j.
-            G->array_vertices[k].infoVertice[Color] = j;
+            G->infoVertices[Color][k] = j;
             // Disminuimos el total de vértices que faltan intercambiar...
             contador_vertices--;
         }
         // Idem para el caso en que el color es j
         else if (color_k == j) {
-            G->array_vertices[k].infoVertice[Color] = i;
+            G->infoVertices[Color][k] = i;
             contador_vertices--;
         }
         // Sino es ni color i ni j seguimos...
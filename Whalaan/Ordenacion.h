@@ -6,6 +6,7 @@
 #ifndef Ordenacion_H
 #define Ordenacion_H
 
+#include "Espacio.h"
 #include "Rii.h"
 
 // Tipo para diferenciar entre las funciones que debe tomar el qsort() en los
@@ -23,13 +24,10 @@ typedef struct _Aux_Array_ {
     u32 datoVertice;
 } Aux_Array;
 
-// Definimos el tipo puntero a la estructura anterior.
-typedef Aux_Array *Aux_Array_t;
-
 /**
  * @fun: DescendenteGrado(const void * a, const void * b).
- * @param a: puntero a void.
- * @param b: puntero a void.
+ * @param a: puntero a una estructura Aux_Array.
+ * @param b: puntero a una estructura Aux_Array.
  * @return: devuelve 0 si los campos datoVertice de referenciados por a y b son
  * iguales; -1 si a > b, y -1 si b > a.
  */
@@ -37,36 +35,34 @@ int DescendenteDato(const void * a, const void * b);
 
 /**
  * @fun: AscendenteNombre(const void * a, const void * b)
- * @param a: puntero a void.
- * @param b: puntero a void.
+ * @param a: puntero a una estructura Aux_Array.
+ * @param b: puntero a una estructura Aux_Array.
  * @return: devuelve 0 si los campos datoVertice de referenciados por a y b son
  * iguales; 1 si a > b, y -1 si b > a.
  */
 int AscendenteDato(const void * a, const void * b);
 
 /**
- * @fun: GenerarNuevoOrden(Grafo G, Aux_Array_t  *array).
+ * @fun: GenerarNuevoOrden(Grafo G, const Aux_Array array[]).
  * @param G: una estructura grafo inicializada.
  * @param array: un arreglo de estructuras Aux_Array.
  * @brief: un procedimiento que copia en array_orden_vértices del
- * grafo un nuevo orden dado por array y libera la memoria ocupada por cada
- * estructura luego de la copia.
+ * grafo un nuevo orden dado por los índices de array.
  */
-void GenerarNuevoOrden(Grafo G, Aux_Array_t  *array);
+void GenerarNuevoOrden(Grafo G, const Aux_Array array[]);
 
 /**
- * @fun: GuardarIndice_DatoVertice(Grafo grafo, Aux_Array_t *array, enum
+ * @fun: GuardarIndice_DatoVertice(Grafo grafo, Aux_Array array[], enum
         InfoVertice x).
  * @param grafo: una estructura Grafo.
- * @param array: un arreglo de estructuras Aux_Array.
+ * @param array: un arreglo de estructuras Aux_Array, uno por vértice.
  * @param x: la información de un vértice.
  * @brief: es una función que almacena la información del vértice
- * solicitada junto a su posición en array_vertices de la estructura grafo en
+ * solicitada junto a su índice en la estructura grafo en
  * un arreglo de estructuras Aux_Array. La posicion se almacena en el campo
  * índice de la estructura y el dato en el campo datoVertice.
- * @return: retorna 1 si hubo errores; 0 en caso contrario.
  */
-char GuardarIndice_DatoVertice(Grafo grafo, Aux_Array_t *array, enum
+void GuardarIndice_DatoVertice(Grafo grafo, Aux_Array array[], enum
         InfoVertice x);
 
 /**
@@ -81,25 +77,75 @@ char GuardarIndice_DatoVertice(Grafo grafo, Aux_Array_t *array, enum
  */
 char OrdenarSegunX(enum InfoVertice info, enum ModoOrden modo, Grafo G);
 
+/**
+ * @fun: OrdenarSegunXConEspacio(enum InfoVertice info, enum ModoOrden modo,
+ *                               Grafo G, Espacio E).
+ * @param info: la información de un vértice.
+ * @param modo: el modo en que se va a ordenar.
+ * @param G: una estructura Grafo correctamente creada.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como OrdenarSegunX(), pero ordenando en el arreglo de E, sin alocar
+ * memoria.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenarSegunXConEspacio(enum InfoVertice info, enum ModoOrden modo,
+                             Grafo G, Espacio E);
+
+/**
+ * @fun: OrdenNaturalConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como OrdenNatural(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenNaturalConEspacio(Grafo G, Espacio E);
+
+/**
+ * @fun: OrdenWelshPowellConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como OrdenWelshPowell(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenWelshPowellConEspacio(Grafo G, Espacio E);
+
+/**
+ * @fun: RMBCnormalConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como RMBCnormal(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char RMBCnormalConEspacio(Grafo G, Espacio E);
+
+/**
+ * @fun: RMBCrevierteConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como RMBCrevierte(), usando los arreglos de E.
+ * @return: retorna 1 si hubo errores; 0 en caso contrario.
+ */
+char RMBCrevierteConEspacio(Grafo G, Espacio E);
+
 /**
  * @fun: GuardarBloqueColores(Grafo G, u32 cantidadColores,
- *                                    Aux_Array_t *array)
+ *                                    Aux_Array array[])
  * @param G: una estructura grafo correctamente construida.
  * @param cantidadColores: la cantidad de colores del grafo.
- * @param array: un arreglo de estrucutras Aux_Array.
+ * @param array: un arreglo de estrucutras Aux_Array, uno por color.
  * @brief: es una función que almacena un color y la cantidad de vértices de
  * ese color. El color se almacena en el campo índice de la estructura y la
  * cantidad de vértices de ese color en el campo datoVertice.
- * @return: devuelte 1 si ocurrió algun error; 0 en caso contrario.
  */
-char GuardarBloqueColores(Grafo G, u32 cantidadColores, Aux_Array_t *array);
+void GuardarBloqueColores(Grafo G, u32 cantidadColores, Aux_Array array[]);
 
 /**
- * @fun: LiberarBloqueColores(u32 cantColores, Aux_Array_t *bloques).
- * @param cantColores: cantidad de colores del grafo.
- * @param bloques: un arreglo de estructuras Aux_Array.
- * @brief: libera la memoria asignada a bloques.
+ * @fun: RMBCchicograndeConEspacio(Grafo G, Espacio E).
+ * @param G: una estructura Grafo.
+ * @param E: un espacio de trabajo que alcance para G.
+ * @brief: como RMBCchicogrande(), usando los arreglos de E.
+ * @return: Retorna 0 si no hubo errores, 1 si hubo algún problema.
  */
-void LiberarBloqueColores(u32 cantColores, Aux_Array_t *bloques);
+char RMBCchicograndeConEspacio(Grafo G, Espacio E);
 
 #endif
\ No newline at end of file
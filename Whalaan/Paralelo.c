@@ -0,0 +1,379 @@
+/**
+ * @file: Paralelo.c
+ * @brief: implementación de las versiones de Greedy que colorean con varios
+ * hilos.
+ */
+
+#include "Coloreo.h"
+#include "Comprimido.h"
+#include "Hilos.h"
+#include "Paralelo.h"
+
+/**
+ * @fun: HilosParaColorear(u32 num_vertices, u32 num_hilos).
+ * @param num_vertices: cantidad de vértices a colorear.
+ * @param num_hilos: cantidad de hilos pedida; 0 para usar todos los
+ * procesadores.
+ * @return: la cantidad de hilos a usar, sin dar a ninguno menos de
+ * MINIMO_VERTICES_POR_HILO vértices; al menos 1.
+ */
+u32 HilosParaColorear(u32 num_vertices, u32 num_hilos) {
+    if (num_hilos == 0) num_hilos = CantidadDeProcesadores();
+    if (num_vertices / MINIMO_VERTICES_POR_HILO < num_hilos) {
+        num_hilos = num_vertices / MINIMO_VERTICES_POR_HILO;
+    }
+    return num_hilos == 0 ? 1 : num_hilos;
+}
+
+/**
+ * @fun: CrearTrozosGreedy(Grafo G, u32 num_hilos).
+ * @param G: un grafo correctamente construido.
+ * @param num_hilos: cantidad de trozos.
+ * @brief: crea los trozos para colorear G con num_hilos hilos, cada uno con
+ * sus marcas y, si G está comprimido, su arreglo para decodificar vecinos.
+ * Los arreglos de todos los trozos salen del del primero.
+ * @return: los trozos; NULL si no hubo memoria.
+ */
+TrozoGreedy *CrearTrozosGreedy(Grafo G, u32 num_hilos) {
+    size_t tam_delta = (size_t)G->infoGrafo[DeltaGrande] + 1;
+    bool comprimido = EstaComprimido(G);
+    TrozoGreedy *trozos = calloc(num_hilos, sizeof(TrozoGreedy));
+    // Las marcas empiezan en la generación 0, que ningún vértice usa.
+    u32 *marcas = calloc(num_hilos * tam_delta, sizeof(u32));
+    u32 *vecinos = comprimido ?
+            malloc(num_hilos * tam_delta * sizeof(u32)) : NULL;
+    if (trozos == NULL || marcas == NULL || (comprimido && vecinos == NULL)) {
+        free(trozos);
+        free(marcas);
+        free(vecinos);
+        return NULL;
+    }
+    for (u32 k = 0; k < num_hilos; k++) {
+        trozos[k].grafo = G;
+        trozos[k].pendientes = G->array_orden_vertices;
+        trozos[k].marcas = marcas + k * tam_delta;
+        trozos[k].generacion = 0;
+        trozos[k].vecinos = comprimido ? vecinos + k * tam_delta : NULL;
+    }
+    return trozos;
+}
+
+/**
+ * @fun: DestruirTrozosGreedy(TrozoGreedy *trozos).
+ * @param trozos: trozos creados con CrearTrozosGreedy(), o NULL.
+ * @brief: libera los trozos y sus arreglos.
+ */
+void DestruirTrozosGreedy(TrozoGreedy *trozos) {
+    if (trozos == NULL) return;
+    free(trozos[0].marcas);
+    free(trozos[0].vecinos);
+    free(trozos);
+}
+
+/**
+ * @fun: ContarColores(Grafo G).
+ * @param G: un grafo con todos sus vértices coloreados y la cantidad de
+ * vértices de cada color en cero.
+ * @brief: cuenta los vértices de cada color y guarda el número de colores,
+ * como hace Greedy() al colorear.
+ * @return: el número de colores.
+ */
+u32 ContarColores(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 *cantidad = G->array_cantidad_colores;
+    u32 num_colores = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 color_i = colores[i];
+        cantidad[color_i]++;
+        if (color_i + 1 > num_colores) num_colores = color_i + 1;
+    }
+    G->infoGrafo[Colores] = num_colores;
+    return num_colores;
+}
+
+/**
+ * @fun: ColorearTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoGreedy.
+ * @brief: colorea con Greedy, en orden, los vértices del tramo del trozo,
+ * leyendo los colores que tengan sus vecinos en ese momento. Otros hilos
+ * pueden estar coloreando vecinos a la vez, así que dos vecinos pueden
+ * quedar con el mismo color; por eso los colores se leen y escriben con
+ * operaciones atómicas relajadas.
+ * @return: NULL.
+ */
+void *ColorearTrozo(void *trozo) {
+    TrozoGreedy *t = trozo;
+    Grafo G = t->grafo;
+    u32 delta = G->infoGrafo[DeltaGrande];
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *marcas = t->marcas;
+    u32 marca = t->generacion;
+    for (u32 i = t->primero; i < t->fin; i++) {
+        u32 indice_i = t->pendientes[i];
+        u32 grado_i = grados[indice_i];
+        const u32 *vecinos_i = t->vecinos == NULL ?
+                G->array_vecinos + G->inicio_vecinos[indice_i] :
+                VecinosDelIndice(G, indice_i, t->vecinos);
+        u32 color_i = 0;
+        if (delta < COLORES_MASCARA) {
+            // Como GreedyConMascara(); un vecino sin color (UINT_MAX) aporta
+            // un 0.
+            uint64_t prohibidos = 0;
+            for (u32 j = 0; j < grado_i; j++) {
+                u32 color_vecino_j = __atomic_load_n(&colores[vecinos_i[j]],
+                                                     __ATOMIC_RELAXED);
+                prohibidos |= (uint64_t)(color_vecino_j != UINT_MAX)
+                              << (color_vecino_j % COLORES_MASCARA);
+            }
+            color_i = (u32)__builtin_ctzll(~prohibidos);
+        } else if (delta < COLORES_MASCARAS) {
+            // Como GreedyConMascaras(), sin ramas: un vecino sin color
+            // (UINT_MAX) cae en la última palabra pero aporta un 0.
+            uint64_t prohibidos[PALABRAS_MASCARAS] = {0};
+            for (u32 j = 0; j < grado_i; j++) {
+                u32 color_vecino_j = __atomic_load_n(&colores[vecinos_i[j]],
+                                                     __ATOMIC_RELAXED);
+                prohibidos[(color_vecino_j / COLORES_MASCARA) %
+                           PALABRAS_MASCARAS] |=
+                        (uint64_t)(color_vecino_j != UINT_MAX)
+                        << (color_vecino_j % COLORES_MASCARA);
+            }
+            color_i = PrimerColorLibre(prohibidos);
+        } else {
+            // Como GreedyConMarcas().
+            if (++marca == 0) {
+                memset(marcas, 0, ((size_t)delta + 1) * sizeof(u32));
+                marca = 1;
+            }
+            for (u32 j = 0; j < grado_i; j++) {
+                u32 color_vecino_j = __atomic_load_n(&colores[vecinos_i[j]],
+                                                     __ATOMIC_RELAXED);
+                if (color_vecino_j != UINT_MAX) marcas[color_vecino_j] = marca;
+            }
+            while (marcas[color_i] == marca) {
+                color_i++;
+            }
+        }
+        __atomic_store_n(&colores[indice_i], color_i, __ATOMIC_RELAXED);
+    }
+    t->generacion = marca;
+    return NULL;
+}
+
+/**
+ * @fun: DetectarConflictosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoGreedy ya coloreado.
+ * @brief: guarda en el arreglo de conflictos los vértices del tramo que
+ * tienen el mismo color que algún vecino de índice menor. De cada lado en
+ * conflicto se recolorea un solo extremo, y el vértice pendiente de menor
+ * índice nunca queda en conflicto, así que cada ronda avanza.
+ * @return: NULL.
+ */
+void *DetectarConflictosTrozo(void *trozo) {
+    TrozoGreedy *t = trozo;
+    Grafo G = t->grafo;
+    const u32 *colores = G->infoVertices[Color];
+    const u32 *grados = G->infoVertices[Grado];
+    t->num_conflictos = 0;
+    for (u32 i = t->primero; i < t->fin; i++) {
+        u32 indice_i = t->pendientes[i];
+        u32 color_i = colores[indice_i];
+        u32 grado_i = grados[indice_i];
+        const u32 *vecinos_i = t->vecinos == NULL ?
+                G->array_vecinos + G->inicio_vecinos[indice_i] :
+                VecinosDelIndice(G, indice_i, t->vecinos);
+        // Los conflictos son raros, así que se recorren todos los vecinos
+        // sin ramas en lugar de cortar en el primero.
+        u32 conflicto = 0;
+        for (u32 j = 0; j < grado_i; j++) {
+            u32 vecino_j = vecinos_i[j];
+            conflicto |= (vecino_j < indice_i) &
+                         (colores[vecino_j] == color_i);
+        }
+        // Se escribe siempre y sólo se avanza si hubo conflicto.
+        t->conflictos[t->primero + t->num_conflictos] = indice_i;
+        t->num_conflictos += conflicto;
+    }
+    return NULL;
+}
+
+/**
+ * @fun: GreedyParalelo(Grafo G, u32 num_hilos,
+ *                      EstadisticasParalelo *estadisticas).
+ * @param G: un grafo correctamente construido.
+ * @param num_hilos: cantidad de hilos a usar; 0 para usar todos los
+ * procesadores.
+ * @param estadisticas: donde se guardan las rondas y los conflictos del
+ * coloreo; puede ser NULL.
+ * @brief: colorea G con Greedy especulativo. En cada ronda los hilos se
+ * reparten los vértices pendientes en tramos consecutivos del orden del
+ * grafo y los colorean a la vez; luego, también en paralelo, se buscan los
+ * lados con los dos extremos del mismo color y uno de ellos pasa a la ronda
+ * siguiente. Las rondas con pocos vértices se colorean en un solo hilo y no
+ * tienen conflictos. Si G sólo alcanza para un hilo se colorea con Greedy();
+ * si no, el coloreo es propio pero puede usar otros colores. Deja los
+ * colores y la cantidad de vértices de cada color en G, como Greedy().
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 GreedyParalelo(Grafo G, u32 num_hilos,
+                   EstadisticasParalelo *estadisticas) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    num_hilos = HilosParaColorear(numVertices, num_hilos);
+    // Con un solo hilo no hay especulación: Greedy() da el mismo coloreo con
+    // sus núcleos más rápidos.
+    if (num_hilos == 1) {
+        EstadisticasParalelo secuencial = {1, 1, 0};
+        if (estadisticas != NULL) *estadisticas = secuencial;
+        return Greedy(G);
+    }
+    TrozoGreedy *trozos = CrearTrozosGreedy(G, num_hilos);
+    u32 *pendientes = malloc(((size_t)numVertices + 1) * sizeof(u32));
+    u32 *conflictos = malloc(((size_t)numVertices + 1) * sizeof(u32));
+    if (trozos == NULL || pendientes == NULL || conflictos == NULL) {
+        DestruirTrozosGreedy(trozos);
+        free(pendientes);
+        free(conflictos);
+        return 0;
+    }
+    PrepararGreedy(G);
+    memcpy(pendientes, G->array_orden_vertices,
+           (size_t)numVertices * sizeof(u32));
+    u32 num_pendientes = numVertices;
+    EstadisticasParalelo resultado = {num_hilos, 0, 0};
+    size_t tam = sizeof(TrozoGreedy);
+    while (num_pendientes > 0) {
+        resultado.rondas++;
+        // Repartimos en partes iguales los vértices pendientes, sin hacer
+        // trozos demasiado chicos.
+        u32 hilos_ronda = num_pendientes / MINIMO_VERTICES_POR_HILO;
+        if (hilos_ronda > num_hilos) hilos_ronda = num_hilos;
+        if (hilos_ronda == 0) hilos_ronda = 1;
+        for (u32 k = 0; k < hilos_ronda; k++) {
+            trozos[k].pendientes = pendientes;
+            trozos[k].conflictos = conflictos;
+            trozos[k].primero =
+                    (u32)((size_t)num_pendientes * k / hilos_ronda);
+            trozos[k].fin =
+                    (u32)((size_t)num_pendientes * (k + 1) / hilos_ronda);
+        }
+        EjecutarEnHilos(ColorearTrozo, trozos, tam, hilos_ronda);
+        // Un solo hilo colorea como Greedy, sin conflictos.
+        if (hilos_ronda == 1) break;
+        EjecutarEnHilos(DetectarConflictosTrozo, trozos, tam, hilos_ronda);
+        // Juntamos los conflictos de los trozos al principio del arreglo,
+        // en el orden del grafo; cada trozo empieza después del anterior,
+        // así que se pueden mover en el mismo arreglo.
+        u32 num_conflictos = 0;
+        for (u32 k = 0; k < hilos_ronda; k++) {
+            memmove(conflictos + num_conflictos,
+                    conflictos + trozos[k].primero,
+                    (size_t)trozos[k].num_conflictos * sizeof(u32));
+            num_conflictos += trozos[k].num_conflictos;
+        }
+        resultado.conflictos += num_conflictos;
+        u32 *auxiliar = pendientes;
+        pendientes = conflictos;
+        conflictos = auxiliar;
+        num_pendientes = num_conflictos;
+    }
+
+    u32 num_colores = ContarColores(G);
+    if (estadisticas != NULL) *estadisticas = resultado;
+
+    DestruirTrozosGreedy(trozos);
+    free(pendientes);
+    free(conflictos);
+    return num_colores;
+}
+
+/**
+ * @fun: GreedyPorBloques(Grafo G, u32 num_hilos).
+ * @param G: un grafo correctamente construido cuyos colores actuales forman
+ * un coloreo propio, como después de cualquier Greedy().
+ * @param num_hilos: cantidad de hilos a usar; 0 para usar todos los
+ * procesadores.
+ * @brief: colorea G con Greedy en el orden dado, con el mismo resultado que
+ * Greedy(). Los tramos del orden con vértices del mismo color del coloreo
+ * anterior son bloques independientes: después de RMBCnormal(),
+ * RMBCrevierte() o RMBCchicogrande() son las viejas clases de color. El
+ * color que Greedy le da a un vértice de un bloque sólo depende de los
+ * bloques anteriores, así que los hilos se reparten cada bloque grande y
+ * lo colorean a la vez; los bloques chicos se colorean en el hilo que
+ * llama. Si el orden casi no tiene bloques grandes, como pasa con el orden
+ * natural, usa Greedy() directamente.
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 GreedyPorBloques(Grafo G, u32 num_hilos) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 *orden = G->array_orden_vertices;
+    num_hilos = HilosParaColorear(numVertices, num_hilos);
+    if (num_hilos == 1) return Greedy(G);
+    // Fin de cada bloque en el orden, antes de borrar los colores.
+    u32 *limites = malloc(((size_t)numVertices + 1) * sizeof(u32));
+    if (limites == NULL) return 0;
+    u32 num_bloques = 0;
+    u32 inicio = 0;
+    size_t en_bloques_grandes = 0;
+    bool sin_color = false;
+    for (u32 i = 1; i <= numVertices; i++) {
+        sin_color |= colores[orden[i - 1]] == UINT_MAX;
+        if (i < numVertices && colores[orden[i]] == colores[orden[i - 1]]) {
+            continue;
+        }
+        limites[num_bloques++] = i;
+        if (i - inicio >= 2 * MINIMO_VERTICES_POR_HILO) {
+            en_bloques_grandes += i - inicio;
+        }
+        inicio = i;
+    }
+    // Un vértice sin color no da bloques confiables, y si los bloques
+    // grandes no llegan a la mitad de los vértices los hilos no ayudan.
+    if (sin_color || 2 * en_bloques_grandes < numVertices) {
+        free(limites);
+        return Greedy(G);
+    }
+    TrozoGreedy *trozos = CrearTrozosGreedy(G, num_hilos);
+    if (trozos == NULL) {
+        free(limites);
+        return 0;
+    }
+    PrepararGreedy(G);
+    // Los bloques chicos se acumulan en un tramo que se colorea en orden en
+    // el hilo que llama antes del siguiente bloque grande.
+    u32 secuencial = 0;
+    inicio = 0;
+    for (u32 b = 0; b < num_bloques; b++) {
+        u32 fin = limites[b];
+        u32 hilos_bloque = HilosParaColorear(fin - inicio, num_hilos);
+        if (hilos_bloque > 1) {
+            if (secuencial < inicio) {
+                trozos[0].primero = secuencial;
+                trozos[0].fin = inicio;
+                ColorearTrozo(&trozos[0]);
+            }
+            for (u32 k = 0; k < hilos_bloque; k++) {
+                trozos[k].primero = inicio + (u32)((size_t)(fin - inicio) *
+                                                   k / hilos_bloque);
+                trozos[k].fin = inicio + (u32)((size_t)(fin - inicio) *
+                                               (k + 1) / hilos_bloque);
+            }
+            EjecutarEnHilos(ColorearTrozo, trozos, sizeof(TrozoGreedy),
+                            hilos_bloque);
+            secuencial = fin;
+        }
+        inicio = fin;
+    }
+    if (secuencial < numVertices) {
+        trozos[0].primero = secuencial;
+        trozos[0].fin = numVertices;
+        ColorearTrozo(&trozos[0]);
+    }
+
+    u32 num_colores = ContarColores(G);
+    DestruirTrozosGreedy(trozos);
+    free(limites);
+    return num_colores;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file: Paralelo.h
+ * @brief: fichero de las versiones de Greedy que colorean con varios hilos:
+ * la especulativa, que corrige los conflictos en rondas, y la que colorea
+ * en paralelo cada bloque de colores del coloreo anterior.
+ */
+
+#ifndef PARALELO_H
+#define PARALELO_H
+
+#include "Rii.h"
+
+// Cantidad mínima de vértices a colorear por hilo en cada ronda o bloque;
+// con menos no conviene lanzar más hilos y se colorean en el hilo que llama.
+#define MINIMO_VERTICES_POR_HILO (1u << 12)
+
+// Estadísticas de un coloreo con GreedyParalelo().
+typedef struct _EstadisticasParalelo_ {
+    // Hilos con los que se coloreó la primera ronda.
+    u32 hilos;
+    // Rondas de coloreo, incluida la primera.
+    u32 rondas;
+    // Total de vértices que hubo que volver a colorear por tener el mismo
+    // color que un vecino, sumando todas las rondas.
+    size_t conflictos;
+} EstadisticasParalelo;
+
+// Estructura con el trabajo de cada hilo en una ronda de GreedyParalelo() o
+// un bloque de GreedyPorBloques().
+typedef struct _TrozoGreedy_ {
+    // Grafo a colorear.
+    Grafo grafo;
+    // Vértices a colorear en la ronda, en el orden del grafo; el trozo
+    // colorea desde primero hasta fin sin incluirlo.
+    const u32 *pendientes;
+    u32 primero;
+    u32 fin;
+    // Arreglo donde el trozo deja, desde la posición primero, los vértices
+    // de su tramo que quedaron en conflicto, y cuántos son.
+    u32 *conflictos;
+    u32 num_conflictos;
+    // Colores prohibidos del trozo, como en GreedyConMarcas(): delta grande
+    // + 1 marcas y la última generación usada.
+    u32 *marcas;
+    u32 generacion;
+    // Si el grafo está comprimido, arreglo de delta grande elementos donde
+    // el trozo decodifica vecinos; NULL si no.
+    u32 *vecinos;
+} TrozoGreedy;
+
+/**
+ * @fun: HilosParaColorear(u32 num_vertices, u32 num_hilos).
+ * @param num_vertices: cantidad de vértices a colorear.
+ * @param num_hilos: cantidad de hilos pedida; 0 para usar todos los
+ * procesadores.
+ * @return: la cantidad de hilos a usar, sin dar a ninguno menos de
+ * MINIMO_VERTICES_POR_HILO vértices; al menos 1.
+ */
+u32 HilosParaColorear(u32 num_vertices, u32 num_hilos);
+
+/**
+ * @fun: CrearTrozosGreedy(Grafo G, u32 num_hilos).
+ * @param G: un grafo correctamente construido.
+ * @param num_hilos: cantidad de trozos.
+ * @brief: crea los trozos para colorear G con num_hilos hilos, cada uno con
+ * sus marcas y, si G está comprimido, su arreglo para decodificar vecinos.
+ * Los arreglos de todos los trozos salen del del primero.
+ * @return: los trozos; NULL si no hubo memoria.
+ */
+TrozoGreedy *CrearTrozosGreedy(Grafo G, u32 num_hilos);
+
+/**
+ * @fun: DestruirTrozosGreedy(TrozoGreedy *trozos).
+ * @param trozos: trozos creados con CrearTrozosGreedy(), o NULL.
+ * @brief: libera los trozos y sus arreglos.
+ */
+void DestruirTrozosGreedy(TrozoGreedy *trozos);
+
+/**
+ * @fun: ContarColores(Grafo G).
+ * @param G: un grafo con todos sus vértices coloreados y la cantidad de
+ * vértices de cada color en cero.
+ * @brief: cuenta los vértices de cada color y guarda el número de colores,
+ * como hace Greedy() al colorear.
+ * @return: el número de colores.
+ */
+u32 ContarColores(Grafo G);
+
+/**
+ * @fun: ColorearTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoGreedy.
+ * @brief: colorea con Greedy, en orden, los vértices del tramo del trozo,
+ * leyendo los colores que tengan sus vecinos en ese momento. Otros hilos
+ * pueden estar coloreando vecinos a la vez, así que dos vecinos pueden
+ * quedar con el mismo color; por eso los colores se leen y escriben con
+ * operaciones atómicas relajadas.
+ * @return: NULL.
+ */
+void *ColorearTrozo(void *trozo);
+
+/**
+ * @fun: DetectarConflictosTrozo(void *trozo).
+ * @param trozo: puntero a una estructura TrozoGreedy ya coloreado.
+ * @brief: guarda en el arreglo de conflictos los vértices del tramo que
+ * tienen el mismo color que algún vecino de índice menor. De cada lado en
+ * conflicto se recolorea un solo extremo, y el vértice pendiente de menor
+ * índice nunca queda en conflicto, así que cada ronda avanza.
+ * @return: NULL.
+ */
+void *DetectarConflictosTrozo(void *trozo);
+
+/**
+ * @fun: GreedyParalelo(Grafo G, u32 num_hilos,
+ *                      EstadisticasParalelo *estadisticas).
+ * @param G: un grafo correctamente construido.
+ * @param num_hilos: cantidad de hilos a usar; 0 para usar todos los
+ * procesadores.
+ * @param estadisticas: donde se guardan las rondas y los conflictos del
+ * coloreo; puede ser NULL.
+ * @brief: colorea G con Greedy especulativo. En cada ronda los hilos se
+ * reparten los vértices pendientes en tramos consecutivos del orden del
+ * grafo y los colorean a la vez; luego, también en paralelo, se buscan los
+ * lados con los dos extremos del mismo color y uno de ellos pasa a la ronda
+ * siguiente. Las rondas con pocos vértices se colorean en un solo hilo y no
+ * tienen conflictos. Si G sólo alcanza para un hilo se colorea con Greedy();
+ * si no, el coloreo es propio pero puede usar otros colores. Deja los
+ * colores y la cantidad de vértices de cada color en G, como Greedy().
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 GreedyParalelo(Grafo G, u32 num_hilos,
+                   EstadisticasParalelo *estadisticas);
+
+/**
+ * @fun: GreedyPorBloques(Grafo G, u32 num_hilos).
+ * @param G: un grafo correctamente construido cuyos colores actuales forman
+ * un coloreo propio, como después de cualquier Greedy().
+ * @param num_hilos: cantidad de hilos a usar; 0 para usar todos los
+ * procesadores.
+ * @brief: colorea G con Greedy en el orden dado, con el mismo resultado que
+ * Greedy(). Los tramos del orden con vértices del mismo color del coloreo
+ * anterior son bloques independientes: después de RMBCnormal(),
+ * RMBCrevierte() o RMBCchicogrande() son las viejas clases de color. El
+ * color que Greedy le da a un vértice de un bloque sólo depende de los
+ * bloques anteriores, así que los hilos se reparten cada bloque grande y
+ * lo colorean a la vez; los bloques chicos se colorean en el hilo que
+ * llama. Si el orden casi no tiene bloques grandes, como pasa con el orden
+ * natural, usa Greedy() directamente.
+ * @return: el número de colores obtenido; 0 si no hubo memoria.
+ */
+u32 GreedyPorBloques(Grafo G, u32 num_hilos);
+
+#endif // PARALELO_H
@@ -0,0 +1,243 @@
+/**
+ * @file: Reetiquetado.c
+ * @brief: implementación de las funciones para cambiar los índices internos
+ * de los vértices del grafo.
+ */
+
+#include "Reetiquetado.h"
+
+/**
+ * @fun: AscendenteDatoIndice(const void *a, const void *b).
+ * @param a: puntero a una estructura Aux_Array.
+ * @param b: puntero a una estructura Aux_Array.
+ * @return: compara por el campo datoVertice y, si son iguales, por el campo
+ * indice; -1 si a va antes que b, 1 si va después y 0 si son iguales.
+ */
+int AscendenteDatoIndice(const void *a, const void *b) {
+    const Aux_Array *primero = a;
+    const Aux_Array *segundo = b;
+    if (primero->datoVertice != segundo->datoVertice) {
+        return primero->datoVertice < segundo->datoVertice ? -1 : 1;
+    }
+    if (primero->indice != segundo->indice) {
+        return primero->indice < segundo->indice ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * @fun: OrdenPorGrado(Grafo G, u32 nuevo_a_viejo[], bool descendente).
+ * @param G: un grafo correctamente construido.
+ * @param nuevo_a_viejo: arreglo de tantos elementos como vértices.
+ * @param descendente: si los grados van de mayor a menor.
+ * @brief: guarda en nuevo_a_viejo los índices de los vértices ordenados por
+ * grado, usando un ordenamiento por conteo estable, en tiempo lineal.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenPorGrado(Grafo G, u32 nuevo_a_viejo[], bool descendente) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 delta = G->infoGrafo[DeltaGrande];
+    // cantidad[g] es la posición donde va el próximo vértice de grado g.
+    u32 *cantidad = calloc((size_t)delta + 1, sizeof(u32));
+    if (cantidad == NULL) return 1;
+    for (u32 i = 0; i < numVertices; i++) {
+        cantidad[G->infoVertices[Grado][i]]++;
+    }
+    u32 posicion = 0;
+    for (u32 k = 0; k <= delta; k++) {
+        u32 grado = descendente ? delta - k : k;
+        u32 cant = cantidad[grado];
+        cantidad[grado] = posicion;
+        posicion += cant;
+    }
+    for (u32 i = 0; i < numVertices; i++) {
+        nuevo_a_viejo[cantidad[G->infoVertices[Grado][i]]++] = i;
+    }
+    free(cantidad);
+    return 0;
+}
+
+/**
+ * @fun: OrdenBFS(Grafo G, u32 nuevo_a_viejo[], bool por_grado).
+ * @param G: un grafo correctamente construido.
+ * @param nuevo_a_viejo: arreglo de tantos elementos como vértices.
+ * @param por_grado: si es true cada componente empieza en el vértice de
+ * menor grado sin visitar y los vecinos de cada vértice se visitan de menor
+ * a mayor grado, como en Cuthill-McKee; si es false se usa el orden de los
+ * índices para ambas cosas.
+ * @brief: guarda en nuevo_a_viejo los índices de los vértices en el orden en
+ * que los visita un BFS de cada componente.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenBFS(Grafo G, u32 nuevo_a_viejo[], bool por_grado) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 delta = G->infoGrafo[DeltaGrande];
+    // Los comienzos de las componentes se buscan en este orden.
+    u32 *inicios = malloc((size_t)numVertices * sizeof(u32));
+    bool *visitado = calloc(numVertices, sizeof(bool));
+    // Arreglo para ordenar por grado los vecinos de un vértice.
+    Aux_Array *vecinos = por_grado ? malloc(((size_t)delta + 1) *
+                                            sizeof(Aux_Array)) : NULL;
+    if (inicios == NULL || visitado == NULL || (por_grado && vecinos == NULL)
+        || (por_grado && OrdenPorGrado(G, inicios, false))) {
+        free(inicios);
+        free(visitado);
+        free(vecinos);
+        return 1;
+    }
+    if (!por_grado) {
+        for (u32 i = 0; i < numVertices; i++) inicios[i] = i;
+    }
+    // El propio arreglo nuevo_a_viejo es la cola del BFS: los vértices se
+    // encolan en el orden en que se visitan.
+    u32 encolados = 0;
+    for (u32 s = 0; s < numVertices; s++) {
+        u32 inicio = inicios[s];
+        if (visitado[inicio]) continue;
+        visitado[inicio] = true;
+        nuevo_a_viejo[encolados++] = inicio;
+        for (u32 frente = encolados - 1; frente < encolados; frente++) {
+            u32 v = nuevo_a_viejo[frente];
+            u32 *vecinos_v = G->array_vecinos + G->inicio_vecinos[v];
+            u32 grado = G->infoVertices[Grado][v];
+            u32 nuevos = 0;
+            for (u32 j = 0; j < grado; j++) {
+                u32 w = vecinos_v[j];
+                if (visitado[w]) continue;
+                visitado[w] = true;
+                if (por_grado) {
+                    vecinos[nuevos].indice = w;
+                    vecinos[nuevos].datoVertice = G->infoVertices[Grado][w];
+                    nuevos++;
+                } else {
+                    nuevo_a_viejo[encolados++] = w;
+                }
+            }
+            if (por_grado) {
+                qsort(vecinos, nuevos, sizeof(Aux_Array),
+                      AscendenteDatoIndice);
+                for (u32 j = 0; j < nuevos; j++) {
+                    nuevo_a_viejo[encolados++] = vecinos[j].indice;
+                }
+            }
+        }
+    }
+    free(inicios);
+    free(visitado);
+    free(vecinos);
+    return 0;
+}
+
+/**
+ * @fun: AplicarReetiquetado(Grafo G, const u32 nuevo_a_viejo[]).
+ * @param G: un grafo correctamente construido cuya topología no comparte con
+ * ninguna copia ni está en un archivo mapeado.
+ * @param nuevo_a_viejo: permutación de los índices; en la posición k está el
+ * índice actual del vértice que pasa a tener el índice k.
+ * @brief: mueve cada vértice a su nuevo índice y reescribe los arreglos de
+ * vecinos con los nuevos índices, quedando los vecinos de cada vértice de
+ * menor a mayor. El arreglo de orden se traduce, así que el orden de los
+ * vértices, sus nombres y sus colores no cambian.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char AplicarReetiquetado(Grafo G, const u32 nuevo_a_viejo[]) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    size_t cant_vecinos = 2 * (size_t)G->infoGrafo[Lados];
+    u32 *viejo_a_nuevo = malloc((size_t)numVertices * sizeof(u32));
+    u32 *cursor = malloc((size_t)numVertices * sizeof(u32));
+    u32 *vecinos = malloc(cant_vecinos * sizeof(u32));
+    // Arreglo auxiliar para mover un dato de todos los vértices.
+    u32 *datos = malloc((size_t)numVertices * sizeof(u32));
+    if (viejo_a_nuevo == NULL || cursor == NULL || vecinos == NULL ||
+        datos == NULL) {
+        free(viejo_a_nuevo);
+        free(cursor);
+        free(vecinos);
+        free(datos);
+        return 1;
+    }
+    u32 *grados = G->infoVertices[Grado];
+    // Los vecinos de cada vértice pasan a tramos consecutivos en el nuevo
+    // orden.
+    u32 inicio = 0;
+    for (u32 k = 0; k < numVertices; k++) {
+        u32 v = nuevo_a_viejo[k];
+        viejo_a_nuevo[v] = k;
+        cursor[k] = inicio;
+        inicio += grados[v];
+    }
+    // Recorriendo los vértices por su nuevo índice, cada uno se agrega como
+    // vecino de sus vecinos; así los vecinos de todos quedan ordenados sin
+    // tener que ordenarlos.
+    for (u32 k = 0; k < numVertices; k++) {
+        u32 v = nuevo_a_viejo[k];
+        const u32 *vecinos_v = G->array_vecinos + G->inicio_vecinos[v];
+        for (u32 j = 0; j < grados[v]; j++) {
+            vecinos[cursor[viejo_a_nuevo[vecinos_v[j]]]++] = k;
+        }
+    }
+    // Copiamos los vecinos nuevos sobre los del grafo, que tienen el mismo
+    // tamaño, movemos cada dato de los vértices a su nuevo índice y
+    // traducimos el orden.
+    memcpy(G->array_vecinos, vecinos, cant_vecinos * sizeof(u32));
+    for (u32 x = Nombre; x <= Color; x++) {
+        for (u32 k = 0; k < numVertices; k++) {
+            datos[k] = G->infoVertices[x][nuevo_a_viejo[k]];
+        }
+        memcpy(G->infoVertices[x], datos, numVertices * sizeof(u32));
+    }
+    inicio = 0;
+    for (u32 k = 0; k < numVertices; k++) {
+        G->inicio_vecinos[k] = inicio;
+        inicio += grados[k];
+    }
+    for (u32 i = 0; i < numVertices; i++) {
+        G->array_orden_vertices[i] =
+                viejo_a_nuevo[G->array_orden_vertices[i]];
+    }
+    free(viejo_a_nuevo);
+    free(cursor);
+    free(vecinos);
+    free(datos);
+    return 0;
+}
+
+/**
+ * @fun: ReetiquetarGrafo(Grafo G, enum Reetiquetado criterio).
+ * @param G: un grafo correctamente construido cuya topología no comparte con
+ * ninguna copia, no está en un archivo mapeado ni está comprimida.
+ * @param criterio: criterio con el que se reasignan los índices.
+ * @brief: reasigna los índices internos de los vértices para que los
+ * vecinos de cada vértice queden cerca en memoria. Para quien usa el grafo
+ * a través de su orden nada cambia.
+ * @return: 1 si hubo errores o la topología no se puede modificar; 0 en caso
+ * contrario.
+ */
+char ReetiquetarGrafo(Grafo G, enum Reetiquetado criterio) {
+    if (G == NULL) return 1;
+    if (criterio == SinReetiquetar) return 0;
+    // Las copias comparten la topología, un archivo mapeado no se modifica y
+    // los vecinos comprimidos no se pueden reescribir en su lugar.
+    if (G->topologia == NULL || G->topologia->referencias != 1 ||
+        G->topologia->mapeo != NULL ||
+        G->topologia->vecinos_comprimidos != NULL) return 1;
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *nuevo_a_viejo = malloc((size_t)numVertices * sizeof(u32));
+    if (nuevo_a_viejo == NULL) return 1;
+    char error;
+    if (criterio == ReetiquetadoGrado) {
+        error = OrdenPorGrado(G, nuevo_a_viejo, true);
+    } else {
+        error = OrdenBFS(G, nuevo_a_viejo, criterio == ReetiquetadoRCM);
+        // Cuthill-McKee inverso invierte el orden obtenido.
+        for (u32 i = 0; !error && criterio == ReetiquetadoRCM &&
+                        i < numVertices / 2; i++) {
+            u32 aux = nuevo_a_viejo[i];
+            nuevo_a_viejo[i] = nuevo_a_viejo[numVertices - 1 - i];
+            nuevo_a_viejo[numVertices - 1 - i] = aux;
+        }
+    }
+    if (!error) error = AplicarReetiquetado(G, nuevo_a_viejo);
+    free(nuevo_a_viejo);
+    return error;
+}
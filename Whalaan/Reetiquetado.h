@@ -0,0 +1,89 @@
+/**
+ * @file: Reetiquetado.h
+ * @brief: fichero de las funciones para cambiar los índices internos de los
+ * vértices del grafo de forma que vértices vecinos queden cerca en memoria.
+ */
+
+#ifndef REETIQUETADO_H
+#define REETIQUETADO_H
+
+#include "Ordenacion.h"
+#include "Rii.h"
+
+// Criterio con el que se reasignan los índices de los vértices.
+enum Reetiquetado {
+    // Se conservan los índices en el orden de aparición de los nombres.
+    SinReetiquetar,
+    // Cuthill-McKee inverso: BFS desde un vértice de grado mínimo de cada
+    // componente, visitando los vecinos de menor a mayor grado, y luego se
+    // invierte el orden. Reduce el ancho de banda de la matriz de adyacencia.
+    ReetiquetadoRCM,
+    // Orden de un BFS de cada componente, en el orden de los índices.
+    ReetiquetadoBFS,
+    // Vértices de mayor a menor grado, que es el orden en el que los visitan
+    // las ordenaciones de tipo Welsh-Powell.
+    ReetiquetadoGrado
+};
+
+/**
+ * @fun: AscendenteDatoIndice(const void *a, const void *b).
+ * @param a: puntero a una estructura Aux_Array.
+ * @param b: puntero a una estructura Aux_Array.
+ * @return: compara por el campo datoVertice y, si son iguales, por el campo
+ * indice; -1 si a va antes que b, 1 si va después y 0 si son iguales.
+ */
+int AscendenteDatoIndice(const void *a, const void *b);
+
+/**
+ * @fun: OrdenPorGrado(Grafo G, u32 nuevo_a_viejo[], bool descendente).
+ * @param G: un grafo correctamente construido.
+ * @param nuevo_a_viejo: arreglo de tantos elementos como vértices.
+ * @param descendente: si los grados van de mayor a menor.
+ * @brief: guarda en nuevo_a_viejo los índices de los vértices ordenados por
+ * grado, usando un ordenamiento por conteo estable, en tiempo lineal.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenPorGrado(Grafo G, u32 nuevo_a_viejo[], bool descendente);
+
+/**
+ * @fun: OrdenBFS(Grafo G, u32 nuevo_a_viejo[], bool por_grado).
+ * @param G: un grafo correctamente construido.
+ * @param nuevo_a_viejo: arreglo de tantos elementos como vértices.
+ * @param por_grado: si es true cada componente empieza en el vértice de
+ * menor grado sin visitar y los vecinos de cada vértice se visitan de menor
+ * a mayor grado, como en Cuthill-McKee; si es false se usa el orden de los
+ * índices para ambas cosas.
+ * @brief: guarda en nuevo_a_viejo los índices de los vértices en el orden en
+ * que los visita un BFS de cada componente.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char OrdenBFS(Grafo G, u32 nuevo_a_viejo[], bool por_grado);
+
+/**
+ * @fun: AplicarReetiquetado(Grafo G, const u32 nuevo_a_viejo[]).
+ * @param G: un grafo correctamente construido cuya topología no comparte con
+ * ninguna copia ni está en un archivo mapeado.
+ * @param nuevo_a_viejo: permutación de los índices; en la posición k está el
+ * índice actual del vértice que pasa a tener el índice k.
+ * @brief: mueve cada vértice a su nuevo índice y reescribe los arreglos de
+ * vecinos con los nuevos índices, quedando los vecinos de cada vértice de
+ * menor a mayor. El arreglo de orden se traduce, así que el orden de los
+ * vértices, sus nombres y sus colores no cambian.
+ * @return: 1 si hubo errores; 0 en caso contrario.
+ */
+char AplicarReetiquetado(Grafo G, const u32 nuevo_a_viejo[]);
+
+/**
+ * @fun: ReetiquetarGrafo(Grafo G, enum Reetiquetado criterio).
+ * @param G: un grafo correctamente construido cuya topología no comparte con
+ * ninguna copia, no está en un archivo mapeado ni está comprimida.
+ * @param criterio: criterio con el que se reasignan los índices.
+ * @brief: reasigna los índices internos de los vértices para que los
+ * vecinos de cada vértice queden cerca en memoria. Para quien usa el grafo
+ * a través de su orden nada cambia.
+ * @return: 1 si hubo errores o la topología no se puede modificar; 0 en caso
+ * contrario.
+ */
+char ReetiquetarGrafo(Grafo G, enum Reetiquetado criterio);
+
+#endif // REETIQUETADO_H
@@ -24,16 +24,28 @@ enum InfoGrafo { Vertices, Lados, Colores, DeltaGrande};
 // Tipo de dato para referirnos a la información del vértice.
 enum InfoVertice {Nombre, Grado, Color};
 
-// Estructura que implementa cada vértice del grafo.
-typedef struct _VerticeSt_ {
-    // Arreglo que guarda la información del grafo de la siguiente forma:
-    // infoVertice[0]: Nombre del vértice.
-    // infoVertice[1]: Grado del vértice.
-    // infoVertice[2]: Color del vértice.
-    u32 infoVertice[3];
-    // Arreglo de vecinos del vértice.
-    u32 *vecinos_v;
-} VerticeSt;
+// Estructura con la topología del grafo (sus arreglos de vecinos), que no
+// cambia una vez construido y se comparte entre un grafo y sus copias.
+typedef struct _TopologiaSt_ {
+    // Cantidad de grafos que usan esta topología; se modifica atómicamente
+    // para que copias en distintos hilos puedan destruirse sin coordinarse.
+    u32 referencias;
+    // Arena de la que salen la topología y sus arreglos de vecinos.
+    struct _Arena_ *arena;
+    // Si la topología está comprimida, vecinos de todos los vértices
+    // ordenados y codificados como diferencias en enteros de longitud
+    // variable; NULL si no lo está.
+    unsigned char *vecinos_comprimidos;
+    // Posición en vecinos_comprimidos donde comienzan los vecinos de cada
+    // vértice; la posición número de vértices tiene el total de bytes.
+    u32 *inicio_comprimido;
+    // Si el grafo se cargó desde un archivo binario, región mapeada que
+    // contiene sus arreglos de vecinos (y quizás el orden y los colores del
+    // grafo original); NULL si no.
+    void *mapeo;
+    // Tamaño en bytes de la región mapeada.
+    size_t tam_mapeo;
+} TopologiaSt;
 
 // Estructura que implementa el grafo.
 typedef struct _GrafoSt_ {
@@ -43,12 +55,39 @@ typedef struct _GrafoSt_ {
     // infoGrafo[2]: Número de Colores
     // infoGrafo[3]: DeltaGrande del grafo.
     u32 infoGrafo[4];
-    // Arreglo de estructuras vértices
-    VerticeSt *array_vertices;
+    // Información de los vértices, un arreglo por cada dato, de la
+    // siguiente forma (i es el índice del vértice):
+    // infoVertices[0][i]: Nombre del vértice.
+    // infoVertices[1][i]: Grado del vértice.
+    // infoVertices[2][i]: Color del vértice.
+    // Los vecinos del vértice i están en array_vecinos desde la posición
+    // inicio_vecinos[i]. Así Greedy, que sólo lee colores de los vecinos, no
+    // trae a la caché sus nombres ni sus grados.
+    u32 *infoVertices[3];
     // Arreglo que da orden a los vértices
     u32 *array_orden_vertices;
     // Arreglo que cuenta la cantidad de colores usados.
     u32 *array_cantidad_colores;
+    // Arreglo con los índices de los vecinos de todos los vértices, los de
+    // cada vértice a continuación de los del anterior (2 * número de lados).
+    u32 *array_vecinos;
+    // Arreglo con la posición en array_vecinos donde comienzan los vecinos
+    // de cada vértice; la posición número de vértices tiene el total.
+    u32 *inicio_vecinos;
+    // Topología compartida de la que salen array_vecinos e inicio_vecinos,
+    // que son NULL si está comprimida.
+    TopologiaSt *topologia;
+    // Si la topología está comprimida, vecinos decodificados del último
+    // vértice consultado (de tamaño delta grande) y el índice de ese vértice,
+    // o UINT_MAX si no hay ninguno.
+    u32 *vecinos_decodificados;
+    u32 vertice_decodificado;
+    // Espacio de trabajo propio de Greedy, las ordenaciones y Bipartito, en
+    // su propia arena. Se crea en la primera llamada; NULL hasta entonces.
+    struct _EspacioSt_ *espacio;
+    // Arena de la que salen esta estructura, los arreglos de información de
+    // los vértices, el de orden y el de cantidad de colores.
+    struct _Arena_ *arena;
 } GrafoSt;
 
 typedef GrafoSt *Grafo;
@@ -60,6 +99,11 @@ struct _datos_t {
     u32 cant_lados;
     // Arreglo para cargar los lados.
     u32 *arreglo_lados;
+    // Menor y mayor nombre de vértice leídos, para decidir cómo asociar los
+    // nombres con índices al construir el grafo. Quien arme la estructura a
+    // mano tiene que llenarlos con un rango que abarque todos los nombres.
+    u32 nombre_minimo;
+    u32 nombre_maximo;
 };
 
 typedef struct _datos_t * datos_t;
@@ -0,0 +1,404 @@
+/**
+ * @file: Tabucol.c
+ * @brief: implementación de Tabucol.
+ */
+
+#include <time.h>
+
+#include "Arena.h"
+#include "Comprimido.h"
+#include "Paralelo.h"
+#include "Tabucol.h"
+
+/**
+ * @fun: OpcionesTabucolPorDefecto(OpcionesTabucol *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que corre Tabucol() cuando no se indica
+ * otra cosa: 100000 iteraciones por cantidad de colores, 10 segundos en
+ * total, semilla 0 y sin cota inferior.
+ */
+void OpcionesTabucolPorDefecto(OpcionesTabucol *opciones) {
+    opciones->max_iteraciones = 100000;
+    opciones->max_segundos = 10;
+    opciones->semilla = 0;
+    opciones->cota_inferior = 0;
+}
+
+/**
+ * @fun: Segundos().
+ * @return: segundos desde un momento fijo, para medir tiempos.
+ */
+double Segundos(void) {
+    struct timespec ahora;
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    return (double)ahora.tv_sec + (double)ahora.tv_nsec * 1e-9;
+}
+
+/**
+ * @fun: Aleatorio(uint64_t *estado).
+ * @param estado: estado de un generador xorshift64*, distinto de 0.
+ * @brief: avanza el generador. Cada búsqueda tiene el suyo, así que no
+ * comparten estado como rand() y dan lo mismo con la misma semilla.
+ * @return: un número aleatorio de 32 bits.
+ */
+u32 Aleatorio(uint64_t *estado) {
+    uint64_t x = *estado;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *estado = x;
+    return (u32)((x * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+/**
+ * @fun: CrearBusquedaTabu(Grafo G, u32 max_colores, u32 semilla).
+ * @param G: un grafo correctamente construido.
+ * @param max_colores: mayor k con el que se va a buscar, al menos 1.
+ * @param semilla: semilla de los números aleatorios.
+ * @return: una búsqueda sobre G, a iniciar con IniciarBusquedaTabu(); NULL
+ * si no hubo memoria o si las tablas pasan de TABU_MAX_CELDAS celdas.
+ */
+BusquedaTabu *CrearBusquedaTabu(Grafo G, u32 max_colores, u32 semilla) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    size_t celdas = (size_t)numVertices * max_colores;
+    if (celdas > TABU_MAX_CELDAS) return NULL;
+    Arena *arena = ArenaCrear(2 * celdas * sizeof(u32) +
+                              ((size_t)numVertices * 3 + max_colores +
+                               G->infoGrafo[DeltaGrande]) * sizeof(u32),
+                              false);
+    if (arena == NULL) return NULL;
+    BusquedaTabu *busqueda = ArenaAlocar(arena, sizeof(BusquedaTabu));
+    if (busqueda == NULL) {
+        ArenaDestruir(arena);
+        return NULL;
+    }
+    busqueda->arena = arena;
+    busqueda->grafo = G;
+    busqueda->num_vertices = numVertices;
+    busqueda->max_colores = max_colores;
+    busqueda->k = 0;
+    busqueda->colores = ArenaAlocar(arena, (size_t)numVertices *
+                                           sizeof(u32));
+    busqueda->gama = ArenaAlocar(arena, celdas * sizeof(u32));
+    busqueda->tabu = ArenaAlocar(arena, celdas * sizeof(u32));
+    busqueda->en_conflicto = ArenaAlocar(arena, (size_t)numVertices *
+                                                sizeof(u32));
+    busqueda->lugar = ArenaAlocar(arena, (size_t)numVertices * sizeof(u32));
+    busqueda->cantidad = ArenaAlocar(arena, ((size_t)max_colores + 1) *
+                                            sizeof(u32));
+    busqueda->vecinos = NULL;
+    if (EstaComprimido(G)) {
+        busqueda->vecinos = ArenaAlocar(arena,
+                                        ((size_t)G->infoGrafo[DeltaGrande] +
+                                         1) * sizeof(u32));
+    }
+    if (busqueda->colores == NULL || busqueda->gama == NULL ||
+        busqueda->tabu == NULL || busqueda->en_conflicto == NULL ||
+        busqueda->lugar == NULL || busqueda->cantidad == NULL ||
+        (EstaComprimido(G) && busqueda->vecinos == NULL)) {
+        ArenaDestruir(arena);
+        return NULL;
+    }
+    // El estado del generador no puede ser 0.
+    busqueda->aleatorio = ((uint64_t)semilla << 32) | 0x9E3779B9u;
+    busqueda->iteraciones = 0;
+    return busqueda;
+}
+
+/**
+ * @fun: DestruirBusquedaTabu(BusquedaTabu *busqueda).
+ * @param busqueda: una búsqueda creada con CrearBusquedaTabu(), o NULL.
+ * @brief: libera la búsqueda.
+ */
+void DestruirBusquedaTabu(BusquedaTabu *busqueda) {
+    if (busqueda != NULL) ArenaDestruir(busqueda->arena);
+}
+
+/**
+ * @fun: IniciarBusquedaTabu(BusquedaTabu *busqueda, u32 k,
+ *                           const u32 colores[]).
+ * @param busqueda: una búsqueda.
+ * @param k: cantidad de colores, de 1 a max_colores.
+ * @param colores: color de cada vértice; los mayores o iguales a k cuentan
+ * como sin color. Puede ser el arreglo de colores de la búsqueda.
+ * @brief: arma la tabla gama con los vértices con color, y después les da a
+ * los vértices sin color, en orden, el color con menos vecinos de ese color.
+ * Limpia la tabla tabú y calcula los conflictos. Cuesta O(n * k + m).
+ */
+void IniciarBusquedaTabu(BusquedaTabu *busqueda, u32 k, const u32 colores[]) {
+    Grafo G = busqueda->grafo;
+    u32 numVertices = busqueda->num_vertices;
+    u32 *grados = G->infoVertices[Grado];
+    u32 *propios = busqueda->colores;
+    size_t celdas = (size_t)numVertices * k;
+    busqueda->k = k;
+    if (colores != propios) {
+        memcpy(propios, colores, (size_t)numVertices * sizeof(u32));
+    }
+    memset(busqueda->gama, 0, celdas * sizeof(u32));
+    memset(busqueda->tabu, 0, celdas * sizeof(u32));
+    busqueda->iteracion = 0;
+    for (u32 v = 0; v < numVertices; v++) {
+        if (propios[v] >= k) continue;
+        const u32 *vecinos_v = VecinosDelIndice(G, v, busqueda->vecinos);
+        for (u32 j = 0; j < grados[v]; j++) {
+            busqueda->gama[(size_t)vecinos_v[j] * k + propios[v]]++;
+        }
+    }
+    for (u32 v = 0; v < numVertices; v++) {
+        if (propios[v] < k) continue;
+        const u32 *gama_v = busqueda->gama + (size_t)v * k;
+        u32 color = 0;
+        for (u32 c = 1; c < k; c++) {
+            if (gama_v[c] < gama_v[color]) color = c;
+        }
+        propios[v] = color;
+        const u32 *vecinos_v = VecinosDelIndice(G, v, busqueda->vecinos);
+        for (u32 j = 0; j < grados[v]; j++) {
+            busqueda->gama[(size_t)vecinos_v[j] * k + color]++;
+        }
+    }
+    // Cada lado en conflicto se cuenta desde sus dos extremos.
+    size_t extremos = 0;
+    busqueda->num_en_conflicto = 0;
+    for (u32 v = 0; v < numVertices; v++) {
+        u32 mismo_color = busqueda->gama[(size_t)v * k + propios[v]];
+        extremos += mismo_color;
+        busqueda->lugar[v] = UINT_MAX;
+        if (mismo_color > 0) {
+            busqueda->lugar[v] = busqueda->num_en_conflicto;
+            busqueda->en_conflicto[busqueda->num_en_conflicto++] = v;
+        }
+    }
+    busqueda->conflictos = extremos / 2;
+    busqueda->mejor_conflictos = busqueda->conflictos;
+}
+
+/**
+ * @fun: MoverTabu(BusquedaTabu *busqueda, u32 v, u32 color).
+ * @param busqueda: una búsqueda iniciada.
+ * @param v: índice de un vértice.
+ * @param color: color nuevo de v, distinto del actual y menor a k.
+ * @brief: cambia el color de v y actualiza la tabla gama de sus vecinos, los
+ * conflictos y los vértices en conflicto en O(grado de v). No toca la tabla
+ * tabú.
+ */
+void MoverTabu(BusquedaTabu *busqueda, u32 v, u32 color) {
+    Grafo G = busqueda->grafo;
+    u32 k = busqueda->k;
+    u32 *colores = busqueda->colores;
+    u32 *gama = busqueda->gama;
+    u32 *lugar = busqueda->lugar;
+    u32 *en_conflicto = busqueda->en_conflicto;
+    u32 anterior = colores[v];
+    busqueda->conflictos += gama[(size_t)v * k + color];
+    busqueda->conflictos -= gama[(size_t)v * k + anterior];
+    colores[v] = color;
+    const u32 *vecinos_v = VecinosDelIndice(G, v, busqueda->vecinos);
+    u32 grado = G->infoVertices[Grado][v];
+    // Un vértice está en conflicto mientras su fila de gama cuente algún
+    // vecino en su color; sólo pueden cambiar v y los vecinos de los dos
+    // colores.
+    for (u32 j = 0; j <= grado; j++) {
+        u32 u = j < grado ? vecinos_v[j] : v;
+        u32 *gama_u = gama + (size_t)u * k;
+        if (u != v) {
+            gama_u[anterior]--;
+            gama_u[color]++;
+        }
+        bool conflicto = gama_u[colores[u]] > 0;
+        if (conflicto && lugar[u] == UINT_MAX) {
+            lugar[u] = busqueda->num_en_conflicto;
+            en_conflicto[busqueda->num_en_conflicto++] = u;
+        } else if (!conflicto && lugar[u] != UINT_MAX) {
+            u32 ultimo = en_conflicto[--busqueda->num_en_conflicto];
+            en_conflicto[lugar[u]] = ultimo;
+            lugar[ultimo] = lugar[u];
+            lugar[u] = UINT_MAX;
+        }
+    }
+}
+
+/**
+ * @fun: ElegirMovimientoTabu(BusquedaTabu *busqueda, u32 *v, u32 *color).
+ * @param busqueda: una búsqueda iniciada con algún conflicto.
+ * @param v: donde se guarda el vértice a mover.
+ * @param color: donde se guarda su color nuevo.
+ * @brief: entre los cambios de color de los vértices en conflicto, elige el
+ * que más baja los conflictos, al azar entre los empatados. No considera los
+ * tabú, salvo que dejen menos conflictos que los mejores de este k; si todos
+ * lo son, elige un vértice en conflicto y un color al azar. Cuesta
+ * O(vértices en conflicto * k).
+ */
+void ElegirMovimientoTabu(BusquedaTabu *busqueda, u32 *v, u32 *color) {
+    u32 k = busqueda->k;
+    u32 iteracion = busqueda->iteracion;
+    // Un movimiento tabú se acepta si baja los conflictos de más de
+    // aspiracion, es decir, si deja menos que los mejores de este k.
+    int64_t aspiracion = (int64_t)busqueda->conflictos -
+                         (int64_t)busqueda->mejor_conflictos;
+    int64_t mejor_diferencia = INT64_MAX;
+    u32 empates = 0;
+    for (u32 i = 0; i < busqueda->num_en_conflicto; i++) {
+        u32 u = busqueda->en_conflicto[i];
+        const u32 *gama_u = busqueda->gama + (size_t)u * k;
+        const u32 *tabu_u = busqueda->tabu + (size_t)u * k;
+        u32 color_u = busqueda->colores[u];
+        for (u32 c = 0; c < k; c++) {
+            int64_t diferencia = (int64_t)gama_u[c] - gama_u[color_u];
+            if (diferencia > mejor_diferencia || c == color_u) continue;
+            if (tabu_u[c] > iteracion && diferencia >= -aspiracion) continue;
+            if (diferencia < mejor_diferencia) {
+                mejor_diferencia = diferencia;
+                empates = 0;
+            }
+            // Entre los empatados, cada uno queda con la misma probabilidad.
+            if (Aleatorio(&busqueda->aleatorio) % ++empates == 0) {
+                *v = u;
+                *color = c;
+            }
+        }
+    }
+    if (empates == 0) {
+        *v = busqueda->en_conflicto[Aleatorio(&busqueda->aleatorio) %
+                                    busqueda->num_en_conflicto];
+        *color = (busqueda->colores[*v] + 1 +
+                  Aleatorio(&busqueda->aleatorio) % (k - 1)) % k;
+    }
+}
+
+/**
+ * @fun: BuscarTabu(BusquedaTabu *busqueda, u32 max_iteraciones,
+ *                  double limite).
+ * @param busqueda: una búsqueda iniciada.
+ * @param max_iteraciones: máximo de movimientos a hacer.
+ * @param limite: valor de Segundos() en el que se corta; 0 para no cortar
+ * por tiempo.
+ * @brief: hace movimientos de ElegirMovimientoTabu() hasta que no queden
+ * conflictos o se acabe el presupuesto. Cada vértice movido no puede volver
+ * a su color anterior durante la tenencia tabú.
+ * @return: true si el coloreo de la búsqueda quedó propio; false si no.
+ */
+bool BuscarTabu(BusquedaTabu *busqueda, u32 max_iteraciones, double limite) {
+    u32 k = busqueda->k;
+    // Con un solo color no hay a dónde mover un vértice.
+    if (k < 2) return busqueda->conflictos == 0;
+    for (u32 i = 0; i < max_iteraciones && busqueda->conflictos > 0; i++) {
+        if (limite > 0 && i % TABU_ITERACIONES_RELOJ == 0 &&
+            Segundos() >= limite) break;
+        // Si la iteración da la vuelta, las marcas viejas podrían parecer
+        // vigentes, así que se limpian.
+        if (busqueda->iteracion >= UINT_MAX / 2) {
+            memset(busqueda->tabu, 0, (size_t)busqueda->num_vertices * k *
+                                      sizeof(u32));
+            busqueda->iteracion = 0;
+        }
+        u32 v = 0, color = 0;
+        ElegirMovimientoTabu(busqueda, &v, &color);
+        u32 anterior = busqueda->colores[v];
+        MoverTabu(busqueda, v, color);
+        busqueda->iteracion++;
+        busqueda->iteraciones++;
+        busqueda->tabu[(size_t)v * k + anterior] =
+                busqueda->iteracion +
+                Aleatorio(&busqueda->aleatorio) % TABU_TENENCIA_BASE +
+                TABU_TENENCIA_DECIMOS * busqueda->num_en_conflicto / 10;
+        if (busqueda->conflictos < busqueda->mejor_conflictos) {
+            busqueda->mejor_conflictos = busqueda->conflictos;
+        }
+    }
+    return busqueda->conflictos == 0;
+}
+
+/**
+ * @fun: CompactarColores(u32 colores[], u32 numVertices, u32 k,
+ *                        u32 cantidad[]).
+ * @param colores: color de cada vértice, menor a k.
+ * @param numVertices: cantidad de vértices.
+ * @param k: cantidad de colores.
+ * @param cantidad: arreglo de al menos k elementos.
+ * @brief: renumera los colores que tienen algún vértice de 0 en adelante,
+ * respetando su orden.
+ * @return: la cantidad de colores que tienen algún vértice.
+ */
+u32 CompactarColores(u32 colores[], u32 numVertices, u32 k, u32 cantidad[]) {
+    memset(cantidad, 0, (size_t)k * sizeof(u32));
+    for (u32 i = 0; i < numVertices; i++) {
+        cantidad[colores[i]]++;
+    }
+    // cantidad pasa a ser el color nuevo de cada color usado.
+    u32 usados = 0;
+    for (u32 c = 0; c < k; c++) {
+        cantidad[c] = cantidad[c] > 0 ? usados++ : UINT_MAX;
+    }
+    if (usados < k) {
+        for (u32 i = 0; i < numVertices; i++) {
+            colores[i] = cantidad[colores[i]];
+        }
+    }
+    return usados;
+}
+
+/**
+ * @fun: Tabucol(Grafo G, const OpcionesTabucol *opciones).
+ * @param G: un grafo correctamente construido con un coloreo propio, como
+ * después de Greedy().
+ * @param opciones: presupuesto y semilla, o NULL para usar las opciones por
+ * defecto.
+ * @brief: mientras haya presupuesto y k supere la cota inferior, intenta
+ * pasar el coloreo de G de k a k - 1 colores: los vértices de la clase más
+ * chica quedan sin color y IniciarBusquedaTabu() los ubica; luego
+ * BuscarTabu() intenta sacar los conflictos. Si lo logra, ese coloreo pasa a
+ * ser el de G y se sigue con uno menos. Deja en G el último coloreo propio y
+ * la cantidad de vértices de cada color, como Greedy().
+ * @return: el número de colores del coloreo de G; 0 si no hubo memoria o
+ * las tablas pasan de TABU_MAX_CELDAS celdas, y entonces G no cambia.
+ */
+u32 Tabucol(Grafo G, const OpcionesTabucol *opciones) {
+    OpcionesTabucol por_defecto;
+    if (opciones == NULL) {
+        OpcionesTabucolPorDefecto(&por_defecto);
+        opciones = &por_defecto;
+    }
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 k = G->infoGrafo[Colores];
+    u32 minimo = opciones->cota_inferior > 1 ? opciones->cota_inferior : 1;
+    if (k <= minimo) return k;
+    double limite = 0;
+    if (opciones->max_segundos > 0) {
+        limite = Segundos() + opciones->max_segundos;
+    }
+    BusquedaTabu *busqueda = CrearBusquedaTabu(G, k - 1, opciones->semilla);
+    if (busqueda == NULL) return 0;
+    u32 *cantidad = busqueda->cantidad;
+    while (k > minimo && (limite == 0 || Segundos() < limite)) {
+        // Se saca la clase más chica: sus vértices quedan sin color, y los
+        // del último color pasan a ocupar su lugar.
+        memset(cantidad, 0, (size_t)k * sizeof(u32));
+        for (u32 i = 0; i < numVertices; i++) {
+            cantidad[colores[i]]++;
+        }
+        u32 chica = 0;
+        for (u32 c = 1; c < k; c++) {
+            if (cantidad[c] < cantidad[chica]) chica = c;
+        }
+        for (u32 i = 0; i < numVertices; i++) {
+            u32 color_i = colores[i];
+            if (color_i == chica) {
+                color_i = UINT_MAX;
+            } else if (color_i == k - 1) {
+                color_i = chica;
+            }
+            busqueda->colores[i] = color_i;
+        }
+        IniciarBusquedaTabu(busqueda, k - 1, busqueda->colores);
+        if (!BuscarTabu(busqueda, opciones->max_iteraciones, limite)) break;
+        k = CompactarColores(busqueda->colores, numVertices, k - 1, cantidad);
+        memcpy(colores, busqueda->colores, (size_t)numVertices * sizeof(u32));
+    }
+    DestruirBusquedaTabu(busqueda);
+    memset(G->array_cantidad_colores, 0,
+           ((size_t)G->infoGrafo[DeltaGrande] + 1) * sizeof(u32));
+    return ContarColores(G);
+}
@@ -0,0 +1,203 @@
+/**
+ * @file: Tabucol.h
+ * @brief: fichero de Tabucol, la búsqueda tabú que parte de un coloreo
+ * propio e intenta sacarle colores de a uno por vez.
+ */
+
+#ifndef TABUCOL_H
+#define TABUCOL_H
+
+#include <stdint.h>
+
+#include "Rii.h"
+
+// Tenencia tabú, como en Galinier y Hao: un vértice que deja un color no
+// puede volver a él durante una cantidad aleatoria de 0 a
+// TABU_TENENCIA_BASE - 1 iteraciones, más TABU_TENENCIA_DECIMOS décimos de
+// la cantidad de vértices en conflicto.
+#define TABU_TENENCIA_BASE 10
+#define TABU_TENENCIA_DECIMOS 6
+
+// Cada cuántas iteraciones se mira el reloj.
+#define TABU_ITERACIONES_RELOJ 1024
+
+// Máximo de celdas de las tablas de vértices por colores; con más no se
+// intenta la búsqueda.
+#define TABU_MAX_CELDAS ((size_t)1 << 26)
+
+// Opciones de Tabucol().
+typedef struct _OpcionesTabucol_ {
+    // Iteraciones para intentar cada cantidad de colores; si en ellas no
+    // encuentra un coloreo propio, se queda con el último que encontró.
+    u32 max_iteraciones;
+    // Segundos para toda la búsqueda; 0 para no limitarla.
+    double max_segundos;
+    // Semilla de los números aleatorios de la búsqueda.
+    u32 semilla;
+    // Cantidad de colores por debajo de la cual se sabe que no hay coloreo,
+    // como el tamaño de una clique; al alcanzarla se termina. 0 si no se
+    // conoce.
+    u32 cota_inferior;
+} OpcionesTabucol;
+
+// Estado de una búsqueda tabú de un coloreo con k colores, no
+// necesariamente propio. Sólo lee la topología del grafo, así que varias
+// búsquedas pueden correr a la vez en distintos hilos sobre el mismo grafo.
+typedef struct _BusquedaTabu_ {
+    Grafo grafo;
+    u32 num_vertices;
+    // Colores con los que se creó la búsqueda, y con los que se busca ahora.
+    u32 max_colores;
+    u32 k;
+    // Color de cada vértice, de 0 a k - 1.
+    u32 *colores;
+    // gama[v * k + c] es la cantidad de vecinos de v con color c.
+    u32 *gama;
+    // tabu[v * k + c] es la iteración hasta la que v no puede volver a c.
+    u32 *tabu;
+    u32 iteracion;
+    // Vértices con algún vecino de su color, y lugar de cada vértice en ese
+    // arreglo; UINT_MAX si no está.
+    u32 *en_conflicto;
+    u32 *lugar;
+    u32 num_en_conflicto;
+    // Lados con los dos extremos del mismo color, ahora y los menos que hubo
+    // con este k.
+    size_t conflictos;
+    size_t mejor_conflictos;
+    // Arreglo de max_colores + 1 elementos para contar los vértices de cada
+    // color.
+    u32 *cantidad;
+    // Si el grafo está comprimido, arreglo de delta grande elementos donde se
+    // decodifican vecinos; NULL si no.
+    u32 *vecinos;
+    // Estado del generador de números aleatorios.
+    uint64_t aleatorio;
+    // Iteraciones hechas en total.
+    uint64_t iteraciones;
+    struct _Arena_ *arena;
+} BusquedaTabu;
+
+/**
+ * @fun: OpcionesTabucolPorDefecto(OpcionesTabucol *opciones).
+ * @param opciones: estructura a inicializar.
+ * @brief: carga las opciones con las que corre Tabucol() cuando no se indica
+ * otra cosa: 100000 iteraciones por cantidad de colores, 10 segundos en
+ * total, semilla 0 y sin cota inferior.
+ */
+void OpcionesTabucolPorDefecto(OpcionesTabucol *opciones);
+
+/**
+ * @fun: Segundos().
+ * @return: segundos desde un momento fijo, para medir tiempos.
+ */
+double Segundos(void);
+
+/**
+ * @fun: Aleatorio(uint64_t *estado).
+ * @param estado: estado de un generador xorshift64*, distinto de 0.
+ * @brief: avanza el generador. Cada búsqueda tiene el suyo, así que no
+ * comparten estado como rand() y dan lo mismo con la misma semilla.
+ * @return: un número aleatorio de 32 bits.
+ */
+u32 Aleatorio(uint64_t *estado);
+
+/**
+ * @fun: CrearBusquedaTabu(Grafo G, u32 max_colores, u32 semilla).
+ * @param G: un grafo correctamente construido.
+ * @param max_colores: mayor k con el que se va a buscar, al menos 1.
+ * @param semilla: semilla de los números aleatorios.
+ * @return: una búsqueda sobre G, a iniciar con IniciarBusquedaTabu(); NULL
+ * si no hubo memoria o si las tablas pasan de TABU_MAX_CELDAS celdas.
+ */
+BusquedaTabu *CrearBusquedaTabu(Grafo G, u32 max_colores, u32 semilla);
+
+/**
+ * @fun: DestruirBusquedaTabu(BusquedaTabu *busqueda).
+ * @param busqueda: una búsqueda creada con CrearBusquedaTabu(), o NULL.
+ * @brief: libera la búsqueda.
+ */
+void DestruirBusquedaTabu(BusquedaTabu *busqueda);
+
+/**
+ * @fun: IniciarBusquedaTabu(BusquedaTabu *busqueda, u32 k,
+ *                           const u32 colores[]).
+ * @param busqueda: una búsqueda.
+ * @param k: cantidad de colores, de 1 a max_colores.
+ * @param colores: color de cada vértice; los mayores o iguales a k cuentan
+ * como sin color. Puede ser el arreglo de colores de la búsqueda.
+ * @brief: arma la tabla gama con los vértices con color, y después les da a
+ * los vértices sin color, en orden, el color con menos vecinos de ese color.
+ * Limpia la tabla tabú y calcula los conflictos. Cuesta O(n * k + m).
+ */
+void IniciarBusquedaTabu(BusquedaTabu *busqueda, u32 k, const u32 colores[]);
+
+/**
+ * @fun: MoverTabu(BusquedaTabu *busqueda, u32 v, u32 color).
+ * @param busqueda: una búsqueda iniciada.
+ * @param v: índice de un vértice.
+ * @param color: color nuevo de v, distinto del actual y menor a k.
+ * @brief: cambia el color de v y actualiza la tabla gama de sus vecinos, los
+ * conflictos y los vértices en conflicto en O(grado de v). No toca la tabla
+ * tabú.
+ */
+void MoverTabu(BusquedaTabu *busqueda, u32 v, u32 color);
+
+/**
+ * @fun: ElegirMovimientoTabu(BusquedaTabu *busqueda, u32 *v, u32 *color).
+ * @param busqueda: una búsqueda iniciada con algún conflicto.
+ * @param v: donde se guarda el vértice a mover.
+ * @param color: donde se guarda su color nuevo.
+ * @brief: entre los cambios de color de los vértices en conflicto, elige el
+ * que más baja los conflictos, al azar entre los empatados. No considera los
+ * tabú, salvo que dejen menos conflictos que los mejores de este k; si todos
+ * lo son, elige un vértice en conflicto y un color al azar. Cuesta
+ * O(vértices en conflicto * k).
+ */
+void ElegirMovimientoTabu(BusquedaTabu *busqueda, u32 *v, u32 *color);
+
+/**
+ * @fun: BuscarTabu(BusquedaTabu *busqueda, u32 max_iteraciones,
+ *                  double limite).
+ * @param busqueda: una búsqueda iniciada.
+ * @param max_iteraciones: máximo de movimientos a hacer.
+ * @param limite: valor de Segundos() en el que se corta; 0 para no cortar
+ * por tiempo.
+ * @brief: hace movimientos de ElegirMovimientoTabu() hasta que no queden
+ * conflictos o se acabe el presupuesto. Cada vértice movido no puede volver
+ * a su color anterior durante la tenencia tabú.
+ * @return: true si el coloreo de la búsqueda quedó propio; false si no.
+ */
+bool BuscarTabu(BusquedaTabu *busqueda, u32 max_iteraciones, double limite);
+
+/**
+ * @fun: CompactarColores(u32 colores[], u32 numVertices, u32 k,
+ *                        u32 cantidad[]).
+ * @param colores: color de cada vértice, menor a k.
+ * @param numVertices: cantidad de vértices.
+ * @param k: cantidad de colores.
+ * @param cantidad: arreglo de al menos k elementos.
+ * @brief: renumera los colores que tienen algún vértice de 0 en adelante,
+ * respetando su orden.
+ * @return: la cantidad de colores que tienen algún vértice.
+ */
+u32 CompactarColores(u32 colores[], u32 numVertices, u32 k, u32 cantidad[]);
+
+/**
+ * @fun: Tabucol(Grafo G, const OpcionesTabucol *opciones).
+ * @param G: un grafo correctamente construido con un coloreo propio, como
+ * después de Greedy().
+ * @param opciones: presupuesto y semilla, o NULL para usar las opciones por
+ * defecto.
+ * @brief: mientras haya presupuesto y k supere la cota inferior, intenta
+ * pasar el coloreo de G de k a k - 1 colores: los vértices de la clase más
+ * chica quedan sin color y IniciarBusquedaTabu() los ubica; luego
+ * BuscarTabu() intenta sacar los conflictos. Si lo logra, ese coloreo pasa a
+ * ser el de G y se sigue con uno menos. Deja en G el último coloreo propio y
+ * la cantidad de vértices de cada color, como Greedy().
+ * @return: el número de colores del coloreo de G; 0 si no hubo memoria o
+ * las tablas pasan de TABU_MAX_CELDAS celdas, y entonces G no cambia.
+ */
+u32 Tabucol(Grafo G, const OpcionesTabucol *opciones);
+
+#endif // TABUCOL_H
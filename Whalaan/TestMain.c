@@ -2,9 +2,18 @@
 // Created by pablonr on 05/04/19.
 //
 
+#include "Binario.h"
+#include "Clique.h"
+#include "Coloreo.h"
+#include "Construye.h"
+#include "Evolutivo.h"
+#include "Exacto.h"
+#include "Paralelo.h"
+#include "Tabucol.h"
 #include "TestMain.h"
 #include "TestOrdenacion.h"
 #include <time.h>
+#include <unistd.h>
 
 char test_ColoreoPropio(Grafo grafo) {
     u32 color_vertice_i, grado_vertice_i, color_jotaesimo_vecino;
@@ -22,6 +31,91 @@ char test_ColoreoPropio(Grafo grafo) {
     return 0;
 }
 
+// Devuelve una carga con lugar para num_lados lados entre los vértices de
+// nombres 0 a num_vertices - 1, para generar grafos sin leer un archivo; NULL
+// si no hubo memoria.
+datos_t CargaDeLados(u32 num_vertices, u32 num_lados) {
+    datos_t carga = calloc(1, sizeof(struct _datos_t));
+    if (carga == NULL) return NULL;
+    carga->arreglo_lados = malloc(2 * (size_t)num_lados * sizeof(u32));
+    if (carga->arreglo_lados == NULL) {
+        DestruccionCargaDatos(carga);
+        return NULL;
+    }
+    carga->cant_vertices = num_vertices;
+    carga->cant_lados = num_lados;
+    carga->nombre_minimo = 0;
+    carga->nombre_maximo = num_vertices - 1;
+    return carga;
+}
+
+// Devuelve un grafo aleatorio con vértices de nombres 0 a num_vertices - 1,
+// o NULL si hubo errores o num_lados es menor que num_vertices. El lado i
+// une al vértice i, o a uno al azar si i no es un vértice, con otro vértice
+// al azar, así que ninguno queda aislado. Los lados repetidos se eliminan.
+Grafo GrafoAleatorio(u32 num_vertices, u32 num_lados, u32 semilla) {
+    if (num_vertices < 2 || num_lados < num_vertices) return NULL;
+    datos_t carga = CargaDeLados(num_vertices, num_lados);
+    if (carga == NULL) return NULL;
+    srand(semilla);
+    for (u32 i = 0; i < num_lados; i++) {
+        u32 vertice_1 = i < num_vertices ? i : (u32)rand() % num_vertices;
+        // Sumándole entre 1 y num_vertices - 1 nunca da el mismo vértice.
+        u32 vertice_2 = (vertice_1 + 1 + (u32)rand() % (num_vertices - 1)) %
+                        num_vertices;
+        carga->arreglo_lados[2 * (size_t)i] = vertice_1;
+        carga->arreglo_lados[2 * (size_t)i + 1] = vertice_2;
+    }
+    OpcionesConstruccion opciones;
+    OpcionesConstruccionPorDefecto(&opciones);
+    opciones.lados_repetidos = EliminarRepetidos;
+    return ConstruirGrafoDesdeDatos(carga, &opciones);
+}
+
+// Devuelve el grafo de Mycielski con número cromático orden, al menos 2, o
+// NULL si hubo errores. No tiene triángulos, así que su mayor clique tiene 2
+// vértices aunque necesita orden colores. Se arma desde un lado aplicando
+// orden - 2 veces la construcción de Mycielski.
+Grafo GrafoMycielski(u32 orden) {
+    if (orden < 2) return NULL;
+    u32 num_vertices = 2;
+    u32 num_lados = 1;
+    for (u32 k = 2; k < orden; k++) {
+        num_lados = 3 * num_lados + num_vertices;
+        num_vertices = 2 * num_vertices + 1;
+    }
+    datos_t carga = CargaDeLados(num_vertices, num_lados);
+    if (carga == NULL) return NULL;
+    u32 *lados = carga->arreglo_lados;
+    lados[0] = 0;
+    lados[1] = 1;
+    u32 n = 2;
+    u32 m = 1;
+    for (u32 k = 2; k < orden; k++) {
+        // Cada vértice v tiene una sombra n + v, unida a los vecinos de v, y
+        // todas las sombras se unen al vértice nuevo 2n.
+        u32 escritos = m;
+        for (u32 i = 0; i < m; i++) {
+            u32 vertice_1 = lados[2 * i];
+            u32 vertice_2 = lados[2 * i + 1];
+            lados[2 * escritos] = vertice_1;
+            lados[2 * escritos + 1] = n + vertice_2;
+            escritos++;
+            lados[2 * escritos] = vertice_2;
+            lados[2 * escritos + 1] = n + vertice_1;
+            escritos++;
+        }
+        for (u32 v = 0; v < n; v++) {
+            lados[2 * escritos] = n + v;
+            lados[2 * escritos + 1] = 2 * n;
+            escritos++;
+        }
+        m = escritos;
+        n = 2 * n + 1;
+    }
+    return ConstruirGrafoDesdeDatos(carga, NULL);
+}
+
 void test_InfoGrafo(Grafo grafo) {
     u32 numVertices = NumeroDeVertices(grafo);
     printf("El número de vértices del grafo es: %u\n", numVertices);
@@ -47,11 +141,12 @@ char test_Bipartito(Grafo grafo) {
     grafo_copia = CopiarGrafo(grafo);
     // Comprueba si es bipartito ,luego imprime algo.
     esBipartito = Bipartito(grafo_copia);
+    // Se destruye la copia en ambos casos; si no, su referencia mantendría
+    // viva la topología compartida con el grafo original.
+    DestruccionDelGrafo(grafo_copia);
     if (esBipartito) {
         // Bipartito no necesita orden,por eso se ejecuta 1ro.
         printf("Grafo Bipartito\n\n");
-        // Se Destruye por q la comprobacion fue true.
-        DestruccionDelGrafo(grafo_copia);
         return 1;
     } else {
         printf("Grafo No Bipartito...\n\n");
@@ -86,14 +181,75 @@ char test_UnOrdenUnGreedy(Grafo grafo) {
     return 0;
 }
 
+char test_Dsatur(Grafo grafo) {
+    Grafo grafo_copia = CopiarGrafo(grafo);
+    if (grafo_copia == NULL) return 1;
+    printf("*** Test DSATUR sobre el grafo original\n");
+    u32 cantColores = Dsatur(grafo_copia);
+    char error = cantColores == 0 || test_ColoreoPropio(grafo_copia);
+    if (!error) {
+        printf("\t✔ Usando DSATUR, el coloreo obtenido fue = %u\n",
+               cantColores);
+    }
+    DestruccionDelGrafo(grafo_copia);
+    return error;
+}
+
+char test_Rlf(Grafo grafo) {
+    Grafo grafo_copia = CopiarGrafo(grafo);
+    if (grafo_copia == NULL) return 1;
+    printf("*** Test RLF sobre el grafo original\n");
+    u32 cantColores = Rlf(grafo_copia);
+    char error = cantColores == 0 || test_ColoreoPropio(grafo_copia);
+    if (!error) {
+        printf("\t✔ Usando RLF, el coloreo obtenido fue = %u\n",
+               cantColores);
+    }
+    DestruccionDelGrafo(grafo_copia);
+    return error;
+}
+
+char test_Exacto(Grafo grafo) {
+    printf("*** Test coloreo exacto sobre el grafo original\n");
+    if (grafo->infoGrafo[Vertices] > EXACTO_MAX_VERTICES) {
+        printf("\t✔ El grafo tiene más de %u vértices, no se busca el número "
+               "cromático\n", EXACTO_MAX_VERTICES);
+        return 0;
+    }
+    Grafo grafo_copia = CopiarGrafo(grafo);
+    if (grafo_copia == NULL) return 1;
+    OpcionesExacto opciones;
+    OpcionesExactoPorDefecto(&opciones);
+    opciones.max_segundos = 2;
+    ResultadoExacto resultado;
+    u32 cantColores = ColoreoExacto(grafo_copia, &opciones, &resultado);
+    char error = cantColores == 0 || test_ColoreoPropio(grafo_copia);
+    if (!error && resultado.optimo) {
+        printf("\t✔ El número cromático es %u, con %llu nodos\n",
+               cantColores, (unsigned long long)resultado.nodos);
+    } else if (!error) {
+        printf("\t✔ Sin terminar, el número cromático está entre %u y %u\n",
+               resultado.cota_inferior, cantColores);
+    }
+    DestruccionDelGrafo(grafo_copia);
+    return error;
+}
+
 char test_200WelshPowell(Grafo grafo, u32 semilla) {
     char error;
     u32 mejor_coloreo = UINT_MAX - 1;
-    u32 colores, indice;
+    u32 colores, indice, iteraciones;
     Grafo grafo_copia = CopiarGrafo(grafo);
     srand((u32)semilla);
     printf("*** Test 200 Órdenes Welsh Powell para obtener el mejor coloreo\n");
-    for (u32 i = 0; i < 200; ++i) {
+    // Con un coloreo del tamaño de la clique no se puede mejorar.
+    u32 cota = CotaInferiorClique(grafo, NULL);
+    if (cota == 0) {
+        DestruccionDelGrafo(grafo_copia);
+        return 1;
+    }
+    for (iteraciones = 0; iteraciones < 200; ++iteraciones) {
+        if (mejor_coloreo == cota) break;
         indice = (u32)(2 + rand() % 3);
         error = OrdenWelshPowell(grafo);
         if (error) return 1;
@@ -105,7 +261,12 @@ char test_200WelshPowell(Grafo grafo, u32 semilla) {
         error = funcOrdenes[indice](grafo);
         if (error) return 1;
     }
-    printf("\t ✔ El mejor coloreo con 200 Welsh Powell es %d\n", mejor_coloreo);
+    printf("\t ✔ El mejor coloreo con %u Welsh Powell es %d\n", iteraciones,
+           mejor_coloreo);
+    if (mejor_coloreo == cota) {
+        printf("\t ✔ Alcanza la clique de %u vértices, así que es óptimo\n",
+               cota);
+    }
     DestruccionDelGrafo(grafo_copia);
     return 0;
 }
@@ -117,8 +278,15 @@ char test_500SwitchVertices(Grafo grafo, u32 semilla) {
     num_vertices = grafo->infoGrafo[Vertices];
     Grafo grafo_copia = CopiarGrafo(grafo);
     printf("*** Test 500 Switch Vertices para obtener el mejor coloreo\n");
+    u32 cota = CotaInferiorClique(grafo, NULL);
+    if (cota == 0) {
+        DestruccionDelGrafo(grafo_copia);
+        return 1;
+    }
     srand(semilla);
-    for (u32 i = 0; i < 500; ++i) {
+    u32 iteraciones;
+    for (iteraciones = 0; iteraciones < 500; ++iteraciones) {
+        if (mejor_coloreo == cota) break;
         vertice_i = rand() % num_vertices;
         vertice_j = rand() % num_vertices;
         error = SwitchVertices(grafo, vertice_i, vertice_j);
@@ -129,8 +297,12 @@ char test_500SwitchVertices(Grafo grafo, u32 semilla) {
             mejor_coloreo = colores;
         }
     }
-    printf("\t ✔ El mejor coloreo con 500 SwitchVertices aleatorios es %d\n",
-           mejor_coloreo);
+    printf("\t ✔ El mejor coloreo con %u SwitchVertices aleatorios es %d\n",
+           iteraciones, mejor_coloreo);
+    if (mejor_coloreo == cota) {
+        printf("\t ✔ Alcanza la clique de %u vértices, así que es óptimo\n",
+               cota);
+    }
     DestruccionDelGrafo(grafo_copia);
     return 0;
 }
@@ -142,10 +314,19 @@ char test_RMBCs(Grafo grafo, u32 num_iteraciones, u32 semilla) {
     printf("*** Test usando RMBCs aleatoriamente - RMBCNormal se usa con "
            "SwitchColores\n");
     grafo_copia = CopiarGrafo(grafo);
+    // Con un coloreo del tamaño de la clique ya no se puede mejorar, así
+    // que se corta ahí.
+    u32 cota = CotaInferiorClique(grafo_copia, NULL);
+    if (cota == 0) {
+        DestruccionDelGrafo(grafo_copia);
+        return 1;
+    }
     srand(semilla);
-    mejorColoreo = UINT_MAX - 1;
+    mejorColoreo = NumeroDeColores(grafo_copia);
     coloreoAnterior = UINT_MAX - 1;
-    for (u32 j = 0; j < num_iteraciones; j++) {
+    u32 j;
+    for (j = 0; j < num_iteraciones; j++) {
+        if (NumeroDeColores(grafo_copia) == cota) break;
         choise = (u32) (2 + rand() % 3);
         num_colores = NumeroDeColores(grafo_copia);
         // Teorema y advertencia del profe:
@@ -179,8 +360,10 @@ char test_RMBCs(Grafo grafo, u32 num_iteraciones, u32 semilla) {
                 return 1;
             }
         }
-        // Luego de ordenar segun haya tocado, se elige el coloreo actual...
-        coloreoActual = Greedy(grafo_copia);
+        // Luego de ordenar segun haya tocado, se elige el coloreo actual.
+        // Los RMBCs dejan el orden en bloques de colores, así que se puede
+        // colorear cada bloque en paralelo con el mismo resultado de Greedy.
+        coloreoActual = GreedyPorBloques(grafo_copia, 0);
         // Si el coloreo actual es mayor que el anterior...
         if (coloreoActual > coloreoAnterior) {
             // Esto es un error...
@@ -197,7 +380,271 @@ char test_RMBCs(Grafo grafo, u32 num_iteraciones, u32 semilla) {
     }
     // Imprimimos el mejor coloreo al finalizar...
     printf("\t ✔ El mejor coloreo con %u iteraciones usando RMBCs es %u\n",
-           num_iteraciones, mejorColoreo);
+           j, mejorColoreo);
+    if (mejorColoreo == cota) {
+        printf("\t ✔ Alcanza la clique de %u vértices, así que es óptimo\n",
+               cota);
+    }
+    // Los RMBCs nunca suben los colores, así que el último coloreo es el
+    // mejor; Tabucol intenta bajarlo.
+    OpcionesTabucol opciones;
+    OpcionesTabucolPorDefecto(&opciones);
+    opciones.semilla = semilla;
+    opciones.cota_inferior = cota;
+    u32 coloreoTabu = Tabucol(grafo_copia, &opciones);
+    if (coloreoTabu == 0 || test_ColoreoPropio(grafo_copia)) {
+        printf("\t ✖ Error al correr Tabucol sobre el mejor coloreo\n");
+        DestruccionDelGrafo(grafo_copia);
+        return 1;
+    }
+    printf("\t ✔ Tabucol parte de %u colores y obtiene %u\n", mejorColoreo,
+           coloreoTabu);
     DestruccionDelGrafo(grafo_copia);
     return 0;
 }
+
+char test_Tabucol(Grafo grafo, u32 semilla) {
+    Grafo grafo_copia = CopiarGrafo(grafo);
+    if (grafo_copia == NULL) return 1;
+    printf("*** Test Tabucol a partir de Greedy en el orden natural\n");
+    // Sin cota inferior Tabucol no corta en la clique: prueba con un color
+    // menos cada vez hasta que en max_iteraciones no encuentra un coloreo.
+    OpcionesTabucol opciones;
+    OpcionesTabucolPorDefecto(&opciones);
+    opciones.max_iteraciones = 2000;
+    opciones.max_segundos = 0;
+    opciones.semilla = semilla;
+    char error = OrdenNatural(grafo_copia);
+    u32 coloresGreedy = error ? 0 : Greedy(grafo_copia);
+    u32 coloresTabu = 0;
+    if (coloresGreedy != 0) coloresTabu = Tabucol(grafo_copia, &opciones);
+    error = coloresTabu == 0 || coloresTabu > coloresGreedy ||
+            test_ColoreoPropio(grafo_copia);
+    if (!error) {
+        printf("\t✔ Con %u iteraciones por intento, Tabucol pasa de %u a %u "
+               "colores\n", opciones.max_iteraciones, coloresGreedy,
+               coloresTabu);
+    }
+    DestruccionDelGrafo(grafo_copia);
+    return error;
+}
+
+// Colorea G con DSATUR y lo mejora con el coloreo evolutivo, que corta si
+// alcanza la clique de CotaInferiorClique(); devuelve 1 si hubo errores.
+char CorrerEvolutivo(Grafo G, u32 semilla) {
+    OpcionesEvolutivo opciones;
+    OpcionesEvolutivoPorDefecto(&opciones);
+    opciones.semilla = semilla;
+    opciones.max_segundos = 1;
+    opciones.cota_inferior = CotaInferiorClique(G, NULL);
+    EstadisticasEvolutivo estadisticas;
+    u32 coloresDsatur = Dsatur(G);
+    u32 cantColores = 0;
+    // Se mide el tiempo que tardó, que es menos que max_segundos si alcanza
+    // la clique.
+    double inicio = Segundos();
+    if (coloresDsatur != 0 && opciones.cota_inferior != 0) {
+        cantColores = ColoreoEvolutivo(G, &opciones, &estadisticas);
+    }
+    double tiempo = Segundos() - inicio;
+    char error = cantColores == 0 || test_ColoreoPropio(G);
+    if (!error) {
+        printf("\t✔ En %.2f segundos, el coloreo evolutivo pasa de %u a %u "
+               "colores con %u generaciones; la clique tiene %u vértices\n",
+               tiempo, coloresDsatur, cantColores,
+               estadisticas.generaciones, opciones.cota_inferior);
+    }
+    return error;
+}
+
+char test_Evolutivo(Grafo grafo, u32 semilla) {
+    printf("*** Test coloreo evolutivo a partir de DSATUR\n");
+    Grafo grafo_copia = CopiarGrafo(grafo);
+    char error = grafo_copia == NULL || CorrerEvolutivo(grafo_copia, semilla);
+    DestruccionDelGrafo(grafo_copia);
+    if (error) return 1;
+    // El grafo de Mycielski de orden 6 necesita 6 colores pero su clique
+    // tiene 2 vértices, así que la búsqueda no puede cortar en la clique.
+    printf("*** Test coloreo evolutivo sobre el grafo de Mycielski de orden "
+           "6\n");
+    Grafo mycielski = GrafoMycielski(6);
+    error = mycielski == NULL || CorrerEvolutivo(mycielski, semilla);
+    DestruccionDelGrafo(mycielski);
+    return error;
+}
+
+char test_GreedyParalelo(u32 semilla) {
+    u32 hilos[4] = {1, 2, 4, 8};
+    EstadisticasParalelo estadisticas;
+    // Con menos de 2 * MINIMO_VERTICES_POR_HILO vértices GreedyParalelo
+    // usaría un solo hilo, así que se colorea un grafo generado con lugar
+    // para los 8 hilos.
+    Grafo grafo = GrafoAleatorio(16 * MINIMO_VERTICES_POR_HILO,
+                                 32 * MINIMO_VERTICES_POR_HILO, semilla);
+    if (grafo == NULL) return 1;
+    printf("*** Test Greedy paralelo en el orden natural de un grafo de %u "
+           "vértices\n", NumeroDeVertices(grafo));
+    char error = OrdenNatural(grafo);
+    double inicio = Segundos();
+    u32 colores_greedy = error ? 0 : Greedy(grafo);
+    double tiempo_greedy = Segundos() - inicio;
+    if (colores_greedy == 0) error = 1;
+    for (u32 k = 0; k < 4 && !error; k++) {
+        inicio = Segundos();
+        u32 colores = GreedyParalelo(grafo, hilos[k], &estadisticas);
+        double tiempo = Segundos() - inicio;
+        // Con un hilo tiene que dar lo mismo que Greedy, y con más tiene que
+        // usar más de uno.
+        error = colores == 0 || test_ColoreoPropio(grafo) ||
+                (hilos[k] == 1 && colores != colores_greedy) ||
+                (hilos[k] > 1 && estadisticas.hilos < 2);
+        // El número de colores devuelto tiene que ser el de los colores que
+        // quedaron en el grafo.
+        if (!error) {
+            memset(grafo->array_cantidad_colores, 0,
+                   ((size_t)grafo->infoGrafo[DeltaGrande] + 1) * sizeof(u32));
+            error = ContarColores(grafo) != colores;
+        }
+        if (error) {
+            printf("\t✖ Greedy paralelo con %u hilos\n", hilos[k]);
+            break;
+        }
+        printf("\t✔ %u hilos (%u usados): %u colores, %u rondas, "
+               "%zu conflictos, aceleración %.2fx\n", hilos[k],
+               estadisticas.hilos, colores, estadisticas.rondas,
+               estadisticas.conflictos,
+               tiempo > 0 ? tiempo_greedy / tiempo : 0.0);
+    }
+    DestruccionDelGrafo(grafo);
+    return error;
+}
+
+char test_GreedyPorBloques(u32 semilla) {
+    printf("*** Test GreedyPorBloques contra Greedy después de cada RMBC\n");
+    // Con clases de color de al menos 2 * MINIMO_VERTICES_POR_HILO vértices
+    // GreedyPorBloques reparte cada bloque entre varios hilos en lugar de
+    // llamar a Greedy.
+    Grafo grafo = GrafoAleatorio(16 * MINIMO_VERTICES_POR_HILO,
+                                 32 * MINIMO_VERTICES_POR_HILO, semilla);
+    if (grafo == NULL) return 1;
+    u32 numVertices = NumeroDeVertices(grafo);
+    char error = 0;
+    for (u32 j = 0; j < 3 && !error; j++) {
+        for (u32 k = 2; k < 5 && !error; k++) {
+            error = funcOrdenes[k](grafo);
+            if (error) break;
+            // Los RMBCs dejan cada clase de color en un bloque del orden; si
+            // los bloques grandes no llegan a la mitad de los vértices,
+            // GreedyPorBloques llamaría a Greedy y no se probaría nada.
+            size_t en_bloques_grandes = 0;
+            for (u32 c = 0; c < NumeroDeColores(grafo); c++) {
+                u32 cantidad = grafo->array_cantidad_colores[c];
+                if (cantidad >= 2 * MINIMO_VERTICES_POR_HILO) {
+                    en_bloques_grandes += cantidad;
+                }
+            }
+            if (2 * en_bloques_grandes < numVertices) {
+                printf("\t ✖ Las clases de color son chicas para repartir "
+                       "los bloques entre hilos\n");
+                error = 1;
+                break;
+            }
+            // Greedy corre sobre una copia con el mismo orden y los mismos
+            // colores.
+            Grafo grafo_greedy = CopiarGrafo(grafo);
+            if (grafo_greedy == NULL) {
+                error = 1;
+                break;
+            }
+            u32 colores_greedy = Greedy(grafo_greedy);
+            u32 colores_bloques = GreedyPorBloques(grafo, 4);
+            error = colores_bloques == 0 || colores_bloques != colores_greedy
+                    || memcmp(grafo->infoVertices[Color],
+                              grafo_greedy->infoVertices[Color],
+                              numVertices * sizeof(u32)) != 0;
+            if (error) {
+                printf("\t ✖ GreedyPorBloques no da el coloreo de Greedy "
+                       "después de %s\n", nombreOrden[k]);
+            } else {
+                printf("\t ✔ %s: %u colores, %.0f%% de los vértices en "
+                       "bloques repartidos entre hilos\n", nombreOrden[k],
+                       colores_bloques,
+                       100.0 * (double)en_bloques_grandes / numVertices);
+            }
+            DestruccionDelGrafo(grafo_greedy);
+        }
+    }
+    DestruccionDelGrafo(grafo);
+    return error;
+}
+
+// Devuelve 1 si los grafos no tienen los mismos vértices, vecinos, orden y
+// coloreo.
+char CompararGrafos(Grafo G, Grafo H) {
+    if (memcmp(G->infoGrafo, H->infoGrafo, sizeof(G->infoGrafo)) != 0) {
+        return 1;
+    }
+    for (u32 i = 0; i < G->infoGrafo[Vertices]; ++i) {
+        if (G->array_orden_vertices[i] != H->array_orden_vertices[i]) return 1;
+        if (CompararVertices(G, i, H, i)) return 1;
+    }
+    return 0;
+}
+
+char test_Binario(Grafo grafo) {
+    char ruta[] = "/tmp/grafo_binario_XXXXXX";
+    int fd = mkstemp(ruta);
+    if (fd < 0) return 1;
+    close(fd);
+    char error = 0;
+    for (u32 con_coloreo = 0; con_coloreo < 2 && !error; con_coloreo++) {
+        Grafo cargado = NULL;
+        error = GuardarGrafoBinario(grafo, ruta, con_coloreo);
+        if (!error) cargado = CargarGrafoBinario(ruta);
+        if (cargado == NULL) {
+            error = 1;
+        } else if (con_coloreo) {
+            error = CompararGrafos(grafo, cargado);
+        } else {
+            error = test_ColoreoPropio(cargado);
+        }
+        DestruccionDelGrafo(cargado);
+    }
+    // Un archivo con el último vecino fuera de rango, con un color mayor
+    // que delta grande o con otra cantidad de vértices del primer color se
+    // tiene que rechazar al cargarlo.
+    u32 numVertices = grafo->infoGrafo[Vertices];
+    size_t dos_m = 2 * (size_t)grafo->infoGrafo[Lados];
+    long posiciones[3] = {
+        (long)(sizeof(CabeceraBinario) +
+               (3 * (size_t)numVertices + dos_m) * sizeof(u32)),
+        (long)(sizeof(CabeceraBinario) +
+               (4 * (size_t)numVertices + 1 + dos_m) * sizeof(u32)),
+        (long)(sizeof(CabeceraBinario) +
+               (5 * (size_t)numVertices + 1 + dos_m) * sizeof(u32))
+    };
+    for (u32 k = 0; k < 3 && !error && dos_m > 0; k++) {
+        u32 basura = 0x7fffffff;
+        error = GuardarGrafoBinario(grafo, ruta, true);
+        FILE *archivo = error ? NULL : fopen(ruta, "r+b");
+        if (archivo == NULL) {
+            error = 1;
+            break;
+        }
+        error = fseek(archivo, posiciones[k], SEEK_SET) != 0 ||
+                fwrite(&basura, sizeof(u32), 1, archivo) != 1;
+        if (fclose(archivo) != 0) error = 1;
+        Grafo cargado = error ? NULL : CargarGrafoBinario(ruta);
+        if (cargado != NULL) {
+            error = 1;
+            DestruccionDelGrafo(cargado);
+        }
+    }
+    unlink(ruta);
+    if (error) {
+        printf("✖ Error - Guardar y cargar en binario\n");
+    } else {
+        printf("✔ OK - Guardar y cargar en binario\n");
+    }
+    return error;
+}
@@ -15,10 +15,26 @@ char test_Bipartito(Grafo grafo);
 
 char test_UnOrdenUnGreedy(Grafo grafo);
 
+char test_Dsatur(Grafo grafo);
+
+char test_Rlf(Grafo grafo);
+
+char test_Exacto(Grafo grafo);
+
 char test_200WelshPowell(Grafo grafo, u32 semilla);
 
 char test_500SwitchVertices(Grafo grafo, u32 semilla);
 
 char test_RMBCs(Grafo grafo, u32 num_iteraciones, u32 semilla);
 
+char test_Tabucol(Grafo grafo, u32 semilla);
+
+char test_Evolutivo(Grafo grafo, u32 semilla);
+
+char test_Binario(Grafo grafo);
+
+char test_GreedyParalelo(u32 semilla);
+
+char test_GreedyPorBloques(u32 semilla);
+
 #endif //MATDISCRETA2019_TESTMAIN_H
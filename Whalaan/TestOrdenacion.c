@@ -2,6 +2,7 @@
 // Testeo de funciones de ordenación.
 //
 
+#include "Comprimido.h"
 #include "TestOrdenacion.h"
 #include <time.h>
 
@@ -42,9 +43,8 @@ char test_OrdenSegunX(funcionesOrden function, enum InfoVertice x, enum
         for (u32 i =0; i < (grafo->infoGrafo[Vertices]-1); ++i){
             vertice_actual= grafo->array_orden_vertices[i];
             vertice_sucesor = grafo->array_orden_vertices[i+1];
-            dato_actual = grafo->array_vertices[vertice_actual].infoVertice[x];
-            dato_sucesor = grafo->array_vertices[vertice_sucesor]
-                    .infoVertice[x];
+            dato_actual = grafo->infoVertices[x][vertice_actual];
+            dato_sucesor = grafo->infoVertices[x][vertice_sucesor];
             //printf("%u ", dato_actual);
             error = compares[((x%2)+o)](dato_actual,dato_sucesor);
             if (!error) {
@@ -70,8 +70,8 @@ void test_OrdenNatural(Grafo grafo) {
 void test_WelshPowell(Grafo grafo) {
     char error = test_OrdenSegunX(ordenes[Grado], Grado, Normal, grafo);
     char check_delta = (grafo->infoGrafo[DeltaGrande] !=
-                        grafo->array_vertices[grafo->array_orden_vertices[0]]
-                                .infoVertice[Grado]);
+                        grafo->infoVertices[Grado]
+                                [grafo->array_orden_vertices[0]]);
     if (error || check_delta) {
         printf("✖ Error - Orden Welsh-Powell\n");
     }
@@ -100,15 +100,15 @@ void test_RMBCRevierte(Grafo grafo) {
     }
 }
 
-char check_BloqueColores(Grafo G, u32 numColores, Aux_Array_t* bloques) {
+char check_BloqueColores(Grafo G, u32 numColores, Aux_Array bloques[]) {
     u32 vertice_i, color_j, contador_color_j, indice_i;
     vertice_i = contador_color_j = 0;
     for (u32 j = 0; j < numColores; j++) {
-        contador_color_j += bloques[j]->datoVertice;
-        color_j = bloques[j]->indice;
+        contador_color_j += bloques[j].datoVertice;
+        color_j = bloques[j].indice;
         for (u32 k = vertice_i; k < contador_color_j; k++) {
             indice_i = G->array_orden_vertices[k];
-            if (G->array_vertices[indice_i].infoVertice[Color] != color_j) {
+            if (G->infoVertices[Color][indice_i] != color_j) {
                 return 1;
 
             }
@@ -121,9 +121,9 @@ char check_BloqueColores(Grafo G, u32 numColores, Aux_Array_t* bloques) {
 
 void test_RMBCchicogrande(Grafo G) {
     u32 numColores = G->infoGrafo[Colores];
-    Aux_Array_t *bloqueColores = malloc(numColores*sizeof(Aux_Array));
+    Aux_Array *bloqueColores = malloc(numColores*sizeof(Aux_Array));
     GuardarBloqueColores(G, numColores, bloqueColores);
-    qsort(bloqueColores, numColores, sizeof(Aux_Array_t), AscendenteDato);
+    qsort(bloqueColores, numColores, sizeof(Aux_Array), AscendenteDato);
     char error = RMBCchicogrande(G);
     if (error) {
         printf("✖ Falla por error de llamada específica de la función\n");
@@ -134,16 +134,25 @@ void test_RMBCchicogrande(Grafo G) {
     } else {
         printf("✔ OK - RMBCchicogrande\n");
     }
-    LiberarBloqueColores(numColores,bloqueColores);
+    free(bloqueColores);
 }
 
-// Devuelve uno si no son iguales
-char CompararVertices(VerticeSt vert_1, VerticeSt vert_2) {
-    for (u32 i = Nombre; i <= Color; i++) {
-        if (vert_1.infoVertice[i] != vert_2.infoVertice[i]) return 1;
+// Devuelve uno si el vértice de índice indice_g en G y el de índice
+// indice_h en H no son iguales
+char CompararVertices(Grafo G, u32 indice_g, Grafo H, u32 indice_h) {
+    for (u32 x = Nombre; x <= Color; x++) {
+        if (G->infoVertices[x][indice_g] != H->infoVertices[x][indice_h]) {
+            return 1;
+        }
     }
-    for (u32 i = 0; i < vert_1.infoVertice[Grado]; ++i) {
-        if (vert_1.vecinos_v[i] != vert_2.vecinos_v[i]) return 1;
+    // Un grafo y sus copias comparten los vecinos, que pueden estar
+    // comprimidos; en la misma topología sólo un vértice tiene cada nombre.
+    if (G->topologia == H->topologia) return indice_g != indice_h;
+    // Los vecinos se comparan decodificados, cada grafo en su arreglo.
+    const u32 *vecinos_g = VecinosEnCache(G, indice_g);
+    const u32 *vecinos_h = VecinosEnCache(H, indice_h);
+    for (u32 i = 0; i < G->infoVertices[Grado][indice_g]; ++i) {
+        if (vecinos_g[i] != vecinos_h[i]) return 1;
     }
     return 0;
 }
@@ -151,26 +160,26 @@ char CompararVertices(VerticeSt vert_1, VerticeSt vert_2) {
 void test_SwitchVertices(Grafo G) {
     srand((u32) time(NULL));
     u32 pos_i, pos_j, numVertices, counter;
-    VerticeSt vertice_i, vertice_j, new_vertice_i, new_vertice_j;
+    u32 vertice_i, vertice_j, new_vertice_i, new_vertice_j;
     char error1, error2;
     numVertices = G->infoGrafo[Vertices];
     counter = 0;
     for (u32 k = 0; k < 50; ++k) {
         pos_i = rand() % numVertices;
         pos_j = rand() % numVertices;
-        vertice_i = G->array_vertices[G->array_orden_vertices[pos_i]];
-        vertice_j = G->array_vertices[G->array_orden_vertices[pos_j]];
+        vertice_i = G->array_orden_vertices[pos_i];
+        vertice_j = G->array_orden_vertices[pos_j];
         error1 = SwitchVertices(G, pos_i, pos_j);
         if (error1) {
             printf("✖ Falla por error de llamada específica de la función "
                    "en la iteración %u\n", k+1);
         }
-        new_vertice_i = G->array_vertices[G->array_orden_vertices[pos_i]];
-        new_vertice_j = G->array_vertices[G->array_orden_vertices[pos_j]];
+        new_vertice_i = G->array_orden_vertices[pos_i];
+        new_vertice_j = G->array_orden_vertices[pos_j];
         // Despues del intercambio chequeo que el vertice que está en la posición
         // i sea el vértice j, y viceversa.
-        error1 = CompararVertices(vertice_j, new_vertice_i);
-        error2 = CompararVertices(vertice_i, new_vertice_j);
+        error1 = CompararVertices(G, vertice_j, G, new_vertice_i);
+        error2 = CompararVertices(G, vertice_i, G, new_vertice_j);
         if (error1 || error2) {
             printf("✖ Error - SwitchVertices en la iteración %u\n", k+1);
             break;
@@ -187,9 +196,9 @@ char CompararColores(Grafo G, u32 *array, u32 color1, u32 color2,
                      u32 size) {
     for (u32 i = 0; i < size; ++i) {
         if (array[i] == color1) {
-            if (G->array_vertices[i].infoVertice[Color] != color2) return 1;
+            if (G->infoVertices[Color][i] != color2) return 1;
         } else if (array[i] == color2) {
-            if (G->array_vertices[i].infoVertice[Color] != color1) return 1;
+            if (G->infoVertices[Color][i] != color1) return 1;
         } else {
             continue;
         }
@@ -199,7 +208,7 @@ char CompararColores(Grafo G, u32 *array, u32 color1, u32 color2,
 
 void GuardarColores(Grafo G, u32 *array, u32 size) {
     for (u32 i = 0; i < size; ++i) {
-        array[i] = G->array_vertices[i].infoVertice[Color];
+        array[i] = G->infoVertices[Color][i];
     }
 }
 
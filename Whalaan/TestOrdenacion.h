@@ -23,4 +23,6 @@ void test_SwitchVertices(Grafo grafo);
 
 void test_SwitchColores(Grafo grafo);
 
+char CompararVertices(Grafo G, u32 indice_g, Grafo H, u32 indice_h);
+
 #endif // TESTORDENACION_H
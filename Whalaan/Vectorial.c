@@ -0,0 +1,275 @@
+/**
+ * @file: Vectorial.c
+ * @brief: implementación de las versiones vectoriales de los núcleos de
+ * Greedy.
+ */
+
+#include "Coloreo.h"
+#include "Comprimido.h"
+#include "Vectorial.h"
+
+#if GREEDY_VECTORIAL
+#include <immintrin.h>
+#endif
+
+enum NivelVectorial nivel_vectorial_maximo = VectorialAVX512;
+
+/**
+ * @fun: NivelVectorialActivo().
+ * @return: el nivel más alto que soportan el procesador y la compilación,
+ * sin pasar de nivel_vectorial_maximo.
+ */
+enum NivelVectorial NivelVectorialActivo(void) {
+    enum NivelVectorial nivel = VectorialEscalar;
+#if GREEDY_VECTORIAL
+    // Con AVX-512 se sigue usando el núcleo de AVX2 para delta grande menor
+    // a COLORES_MASCARA, así que se piden los dos.
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2")) {
+        nivel = VectorialAVX512;
+    } else if (__builtin_cpu_supports("avx2")) {
+        nivel = VectorialAVX2;
+    }
+#endif
+    return nivel < nivel_vectorial_maximo ? nivel : nivel_vectorial_maximo;
+}
+
+/**
+ * @fun: UsarNivelVectorial(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @return: el nivel con el que colorear G: VectorialEscalar si el grado
+ * promedio es menor a GRADO_PROMEDIO_VECTORIAL o si los índices de sus
+ * vértices no entran en los enteros con signo que usan los gathers; si no,
+ * NivelVectorialActivo().
+ */
+enum NivelVectorial UsarNivelVectorial(Grafo G) {
+    if (G->infoGrafo[Vertices] > INT_MAX) return VectorialEscalar;
+    // Los vértices con menos vecinos que un gather se colorean igual que en
+    // la versión escalar, pero pasando por más llamadas.
+    if (2 * (size_t)G->infoGrafo[Lados] <
+        GRADO_PROMEDIO_VECTORIAL * (size_t)G->infoGrafo[Vertices]) {
+        return VectorialEscalar;
+    }
+    return NivelVectorialActivo();
+}
+
+#if GREEDY_VECTORIAL
+
+/**
+ * @fun: MascaraVecinosAVX2(const u32 colores[], const u32 vecinos[],
+ *                          u32 grado).
+ * @brief: como MascaraVecinos(), trayendo los colores de a 8 vecinos con un
+ * gather; los que no completan un gather se pasan a MascaraVecinos().
+ */
+__attribute__((target("avx2")))
+uint64_t MascaraVecinosAVX2(const u32 colores[], const u32 vecinos[],
+                            u32 grado) {
+    const __m256i uno = _mm256_set1_epi64x(1);
+    __m256i acumulado = _mm256_setzero_si256();
+    u32 j = 0;
+    for (; j + 8 <= grado; j += 8) {
+        __m256i indices = _mm256_loadu_si256((const __m256i *)(vecinos + j));
+        __m256i color = _mm256_i32gather_epi32((const int *)colores, indices,
+                                               sizeof(u32));
+        // Cada mitad se extiende a 64 bits. Desplazar 64 o más posiciones
+        // da 0, así que los vecinos sin color (UINT_MAX) no prenden nada.
+        __m256i bajos = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(color));
+        __m256i altos = _mm256_cvtepu32_epi64(
+                _mm256_extracti128_si256(color, 1));
+        acumulado = _mm256_or_si256(acumulado, _mm256_sllv_epi64(uno, bajos));
+        acumulado = _mm256_or_si256(acumulado, _mm256_sllv_epi64(uno, altos));
+    }
+    __m128i mitad = _mm_or_si128(_mm256_castsi256_si128(acumulado),
+                                 _mm256_extracti128_si256(acumulado, 1));
+    return (uint64_t)_mm_cvtsi128_si64(mitad) |
+           (uint64_t)_mm_extract_epi64(mitad, 1) |
+           MascaraVecinos(colores, vecinos + j, grado - j);
+}
+
+/**
+ * @fun: MascarasVecinosAVX512(const u32 colores[], const u32 vecinos[],
+ *                             u32 grado, uint64_t prohibidos[]).
+ * @brief: como MascarasVecinos(), trayendo los colores de a 16 vecinos con
+ * un gather; cada bit se combina con la palabra que le corresponde
+ * comparando su número de palabra. Los vecinos que no completan un gather se
+ * pasan a MascarasVecinos().
+ */
+__attribute__((target("avx512f")))
+void MascarasVecinosAVX512(const u32 colores[], const u32 vecinos[],
+                           u32 grado, uint64_t prohibidos[]) {
+    const __m512i uno = _mm512_set1_epi64(1);
+    const __m512i resto = _mm512_set1_epi64(COLORES_MASCARA - 1);
+    __m512i acumulado[PALABRAS_MASCARAS];
+    for (u32 k = 0; k < PALABRAS_MASCARAS; k++) {
+        acumulado[k] = _mm512_setzero_si512();
+    }
+    u32 j = 0;
+    for (; j + 16 <= grado; j += 16) {
+        __m512i indices = _mm512_loadu_si512(vecinos + j);
+        __m512i color = _mm512_i32gather_epi32(indices, colores,
+                                               sizeof(u32));
+        __m512i mitades[2] = {
+            _mm512_cvtepu32_epi64(_mm512_castsi512_si256(color)),
+            _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(color, 1))
+        };
+        for (u32 h = 0; h < 2; h++) {
+            // Un vecino sin color tiene un número de palabra enorme, que no
+            // coincide con ninguna.
+            __m512i palabra = _mm512_srli_epi64(mitades[h], 6);
+            __m512i bit = _mm512_sllv_epi64(uno,
+                                            _mm512_and_si512(mitades[h],
+                                                             resto));
+            for (u32 k = 0; k < PALABRAS_MASCARAS; k++) {
+                __mmask8 es_k = _mm512_cmpeq_epi64_mask(
+                        palabra, _mm512_set1_epi64(k));
+                acumulado[k] = _mm512_mask_or_epi64(acumulado[k], es_k,
+                                                    acumulado[k], bit);
+            }
+        }
+    }
+    for (u32 k = 0; k < PALABRAS_MASCARAS; k++) {
+        prohibidos[k] |= (uint64_t)_mm512_reduce_or_epi64(acumulado[k]);
+    }
+    MascarasVecinos(colores, vecinos + j, grado - j, prohibidos);
+}
+
+/**
+ * @fun: GreedyConMascaraAVX2(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARA.
+ * @brief: como GreedyConMascara(), trayendo los colores de 8 vecinos con un
+ * gather y prendiendo sus bits con desplazamientos de 64 bits, que dan 0
+ * para los vecinos sin color.
+ * @return: el número de colores obtenido.
+ */
+__attribute__((target("avx2")))
+u32 GreedyConMascaraAVX2(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *orden = G->array_orden_vertices;
+    u32 *cantidad = G->array_cantidad_colores;
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 indice_i = orden[i];
+        uint64_t prohibidos = MascaraVecinosAVX2(colores,
+                                                 VecinosEnCache(G, indice_i),
+                                                 grados[indice_i]);
+        u32 color_i = (u32)__builtin_ctzll(~prohibidos);
+        colores[indice_i] = color_i;
+        cantidad[color_i]++;
+        if (color_i + 1 > num_colores) num_colores = color_i + 1;
+    }
+    G->infoGrafo[Colores] = num_colores;
+    return num_colores;
+}
+
+/**
+ * @fun: GreedyConMascarasAVX512(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARAS.
+ * @brief: como GreedyConMascaras(), trayendo los colores de 16 vecinos con
+ * un gather.
+ * @return: el número de colores obtenido.
+ */
+__attribute__((target("avx512f")))
+u32 GreedyConMascarasAVX512(Grafo G) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *orden = G->array_orden_vertices;
+    u32 *cantidad = G->array_cantidad_colores;
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 indice_i = orden[i];
+        uint64_t prohibidos[PALABRAS_MASCARAS] = {0};
+        MascarasVecinosAVX512(colores, VecinosEnCache(G, indice_i),
+                              grados[indice_i], prohibidos);
+        u32 color_i = PrimerColorLibre(prohibidos);
+        colores[indice_i] = color_i;
+        cantidad[color_i]++;
+        if (color_i + 1 > num_colores) num_colores = color_i + 1;
+    }
+    G->infoGrafo[Colores] = num_colores;
+    return num_colores;
+}
+
+/**
+ * @fun: GreedyConMarcasAVX512(Grafo G, u32 marcas[], u32 *generacion).
+ * @param G: un grafo correctamente construido.
+ * @param marcas: arreglo de delta grande + 1 elementos, como en
+ * GreedyConMarcas().
+ * @param generacion: última generación usada con marcas.
+ * @brief: como GreedyConMarcas(), trayendo los colores de 16 vecinos con un
+ * gather y marcando los de los vecinos coloreados con un scatter.
+ * @return: el número de colores obtenido.
+ */
+__attribute__((target("avx512f")))
+u32 GreedyConMarcasAVX512(Grafo G, u32 marcas[], u32 *generacion) {
+    u32 numVertices = G->infoGrafo[Vertices];
+    u32 delta = G->infoGrafo[DeltaGrande];
+    u32 *colores = G->infoVertices[Color];
+    u32 *grados = G->infoVertices[Grado];
+    u32 *orden = G->array_orden_vertices;
+    u32 *cantidad = G->array_cantidad_colores;
+    const __m512i sin_color = _mm512_set1_epi32(-1);
+    PrepararGreedy(G);
+    u32 num_colores = 0;
+    u32 marca = *generacion;
+    for (u32 i = 0; i < numVertices; i++) {
+        u32 indice_i = orden[i];
+        if (++marca == 0) {
+            memset(marcas, 0, ((size_t)delta + 1) * sizeof(u32));
+            marca = 1;
+        }
+        u32 grado_i = grados[indice_i];
+        const u32 *vecinos_i = VecinosEnCache(G, indice_i);
+        __m512i marca_v = _mm512_set1_epi32((int)marca);
+        u32 j = 0;
+        for (; j + 16 <= grado_i; j += 16) {
+            __m512i indices = _mm512_loadu_si512(vecinos_i + j);
+            __m512i color = _mm512_i32gather_epi32(indices, colores,
+                                                   sizeof(u32));
+            // Sólo se marcan los vecinos coloreados; si dos tienen el mismo
+            // color se escribe la misma marca dos veces.
+            __mmask16 coloreados = _mm512_cmpneq_epi32_mask(color, sin_color);
+            _mm512_mask_i32scatter_epi32(marcas, coloreados, color, marca_v,
+                                         sizeof(u32));
+        }
+        for (; j < grado_i; j++) {
+            u32 color_vecino_j = colores[vecinos_i[j]];
+            if (color_vecino_j != UINT_MAX) marcas[color_vecino_j] = marca;
+        }
+        u32 color_i = 0;
+        while (marcas[color_i] == marca) {
+            color_i++;
+        }
+        colores[indice_i] = color_i;
+        cantidad[color_i]++;
+        if (color_i + 1 > num_colores) num_colores = color_i + 1;
+    }
+    *generacion = marca;
+    G->infoGrafo[Colores] = num_colores;
+    return num_colores;
+}
+
+#else
+
+// Sin núcleos vectoriales NivelVectorialActivo() siempre devuelve
+// VectorialEscalar, así que estas versiones no se llaman; existen para que
+// el despacho compile igual en cualquier arquitectura.
+
+u32 GreedyConMascaraAVX2(Grafo G) {
+    return GreedyConMascara(G);
+}
+
+u32 GreedyConMascarasAVX512(Grafo G) {
+    return GreedyConMascaras(G);
+}
+
+u32 GreedyConMarcasAVX512(Grafo G, u32 marcas[], u32 *generacion) {
+    return GreedyConMarcas(G, marcas, generacion);
+}
+
+#endif // GREEDY_VECTORIAL
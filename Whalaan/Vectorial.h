@@ -0,0 +1,118 @@
+/**
+ * @file: Vectorial.h
+ * @brief: fichero de las versiones vectoriales de los núcleos de Greedy.
+ * Traen los colores de 8 (AVX2) o 16 (AVX-512) vecinos por instrucción y
+ * prenden los colores prohibidos con operaciones de bits o, con AVX-512 y
+ * delta grande, los marcan con un scatter. Cuál se usa se elige al ejecutar
+ * según lo que soporte el procesador; en otras arquitecturas o compiladores
+ * sólo está la versión escalar.
+ */
+
+#ifndef VECTORIAL_H
+#define VECTORIAL_H
+
+#include <stdint.h>
+
+#include "Rii.h"
+
+// Si se compilan los núcleos vectoriales: hacen falta un procesador x86 de
+// 64 bits, porque las máscaras se sacan de los registros con intrínsecos que
+// sólo existen ahí, y los atributos de GCC o Clang para compilar funciones
+// sueltas con AVX2 o AVX-512.
+#if defined(__x86_64__) && defined(__GNUC__)
+#define GREEDY_VECTORIAL 1
+#else
+#define GREEDY_VECTORIAL 0
+#endif
+
+// Grado promedio a partir del cual conviene colorear con los núcleos
+// vectoriales: con menos, la mayoría de los vértices no llena un gather.
+#define GRADO_PROMEDIO_VECTORIAL 16
+
+// Cantidad de vértices hasta la que GreedyConMascarasAVX512() le gana a la
+// versión escalar: con más, los colores no entran en la caché L2 y cada
+// gather espera a la memoria.
+#define VERTICES_MASCARAS_VECTORIAL 32768
+
+// Juego de instrucciones con el que se colorea.
+enum NivelVectorial {VectorialEscalar, VectorialAVX2, VectorialAVX512};
+
+// Nivel más alto que se permite usar; por defecto, todos. Sirve para
+// comparar los núcleos entre sí o forzar la versión escalar.
+extern enum NivelVectorial nivel_vectorial_maximo;
+
+/**
+ * @fun: NivelVectorialActivo().
+ * @return: el nivel más alto que soportan el procesador y la compilación,
+ * sin pasar de nivel_vectorial_maximo.
+ */
+enum NivelVectorial NivelVectorialActivo(void);
+
+/**
+ * @fun: UsarNivelVectorial(Grafo G).
+ * @param G: un grafo correctamente construido.
+ * @return: el nivel con el que colorear G: VectorialEscalar si el grado
+ * promedio es menor a GRADO_PROMEDIO_VECTORIAL o si los índices de sus
+ * vértices no entran en los enteros con signo que usan los gathers; si no,
+ * NivelVectorialActivo().
+ */
+enum NivelVectorial UsarNivelVectorial(Grafo G);
+
+#if GREEDY_VECTORIAL
+
+/**
+ * @fun: MascaraVecinosAVX2(const u32 colores[], const u32 vecinos[],
+ *                          u32 grado).
+ * @brief: como MascaraVecinos(), trayendo los colores de a 8 vecinos con un
+ * gather; los que no completan un gather se pasan a MascaraVecinos().
+ */
+uint64_t MascaraVecinosAVX2(const u32 colores[], const u32 vecinos[],
+                            u32 grado);
+
+/**
+ * @fun: MascarasVecinosAVX512(const u32 colores[], const u32 vecinos[],
+ *                             u32 grado, uint64_t prohibidos[]).
+ * @brief: como MascarasVecinos(), trayendo los colores de a 16 vecinos con
+ * un gather; cada bit se combina con la palabra que le corresponde
+ * comparando su número de palabra. Los vecinos que no completan un gather se
+ * pasan a MascarasVecinos().
+ */
+void MascarasVecinosAVX512(const u32 colores[], const u32 vecinos[],
+                           u32 grado, uint64_t prohibidos[]);
+
+#endif // GREEDY_VECTORIAL
+
+/**
+ * @fun: GreedyConMascaraAVX2(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARA.
+ * @brief: como GreedyConMascara(), trayendo los colores de 8 vecinos con un
+ * gather y prendiendo sus bits con desplazamientos de 64 bits, que dan 0
+ * para los vecinos sin color.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMascaraAVX2(Grafo G);
+
+/**
+ * @fun: GreedyConMascarasAVX512(Grafo G).
+ * @param G: un grafo correctamente construido con delta grande menor a
+ * COLORES_MASCARAS.
+ * @brief: como GreedyConMascaras(), trayendo los colores de 16 vecinos con
+ * un gather.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMascarasAVX512(Grafo G);
+
+/**
+ * @fun: GreedyConMarcasAVX512(Grafo G, u32 marcas[], u32 *generacion).
+ * @param G: un grafo correctamente construido.
+ * @param marcas: arreglo de delta grande + 1 elementos, como en
+ * GreedyConMarcas().
+ * @param generacion: última generación usada con marcas.
+ * @brief: como GreedyConMarcas(), trayendo los colores de 16 vecinos con un
+ * gather y marcando los de los vecinos coloreados con un scatter.
+ * @return: el número de colores obtenido.
+ */
+u32 GreedyConMarcasAVX512(Grafo G, u32 marcas[], u32 *generacion);
+
+#endif // VECTORIAL_H
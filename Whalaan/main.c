@@ -4,6 +4,7 @@
  * @author: Verónica Leaño, Pablo Nicolás Rosa.
  */
 
+#include "Construye.h"
 #include "Ordenacion.h"
 #include "Rii.h"
 #include "U32ToString.h"
@@ -27,6 +28,22 @@ int main(int argc, char *argv[]){
     num_iteraciones = (u32)atoi(argv[1]);
     // El segundo la semilla para el rand()
     semilla = (u32)atoi(argv[2]);
+    // El tercero, opcional, es la ruta de un archivo DIMACS; si no se da el
+    // grafo se lee desde standard input.
+    char *ruta = argc > 3 ? argv[3] : NULL;
+    // El cuarto, opcional, es la cantidad de hilos para leer el archivo (0
+    // para usar todos los procesadores); por defecto se lee con uno solo.
+    OpcionesConstruccion opciones;
+    OpcionesConstruccionPorDefecto(&opciones);
+    if (argc > 4) opciones.num_hilos = (u32)atoi(argv[4]);
+    // El quinto, opcional, indica con 1 que los lados repetidos se eliminen
+    // en lugar de rechazar el grafo.
+    if (argc > 5 && atoi(argv[5]) == 1) {
+        opciones.lados_repetidos = EliminarRepetidos;
+    }
+    // El sexto, opcional, indica con 1 que los vecinos se guarden
+    // comprimidos.
+    if (argc > 6 && atoi(argv[6]) == 1) opciones.comprimir_vecinos = true;
     
     printf("\t------- ------- TESTEO DE PROYECTO -------  -------\t\n");
     printf("\t------- -------    DISCRETA II     -------  -------\t\n");
@@ -36,7 +53,11 @@ int main(int argc, char *argv[]){
     
     Grafo grafo;     // Original se prueba con greedy
    
-    grafo = ConstruccionDelGrafo();
+    if (ruta != NULL) {
+        grafo = ConstruccionDelGrafoDesdeArchivo(ruta, &opciones);
+    } else {
+        grafo = ConstruccionDelGrafo();
+    }
     if (grafo == NULL) {
         printf("✖ No se puedo construir el grafo\n");
         DestruccionDelGrafo(grafo);
@@ -48,6 +69,11 @@ int main(int argc, char *argv[]){
     // Informacion de grafo.
     printf("\n-------- Información del grafo introducido ------------------\n");
     test_InfoGrafo(grafo);
+    error = test_Binario(grafo);
+    if (error) {
+        printf("✖ Error en guardar y cargar el grafo en binario\n");
+        return 0;
+    }
     printf("---------------------------------------------------------------\n");
 
     printf("\n--------------  Testeo de coloreo  --------------------------\n");
@@ -72,6 +98,46 @@ int main(int argc, char *argv[]){
     }
     printf("\n*************************************************************\n");
 
+    //------------ Test DSATUR -------------------------------------------------
+    error = test_Dsatur(grafo);
+    if (error) {
+        printf("✖ Error en correr DSATUR\n");
+        return 0;
+    }
+    printf("\n*************************************************************\n");
+
+    //------------ Test RLF ----------------------------------------------------
+    error = test_Rlf(grafo);
+    if (error) {
+        printf("✖ Error en correr RLF\n");
+        return 0;
+    }
+    printf("\n*************************************************************\n");
+
+    //------------ Test coloreo exacto -----------------------------------------
+    error = test_Exacto(grafo);
+    if (error) {
+        printf("✖ Error en correr el coloreo exacto\n");
+        return 0;
+    }
+    printf("\n*************************************************************\n");
+
+    //------------ Test Greedy paralelo ----------------------------------------
+    error = test_GreedyParalelo(semilla);
+    if (error) {
+        printf("✖ Error en correr Greedy paralelo\n");
+        return 0;
+    }
+    printf("\n*************************************************************\n");
+
+    //------------ Test Greedy por bloques ------------------------------------
+    error = test_GreedyPorBloques(semilla);
+    if (error) {
+        printf("✖ Error en correr Greedy por bloques\n");
+        return 0;
+    }
+    printf("\n*************************************************************\n");
+
     //------------ Test 200 Orden Welsh-Powell --------------------------------
     error = test_200WelshPowell(grafo, semilla);
     if (error) {
@@ -94,6 +160,22 @@ int main(int argc, char *argv[]){
         printf("✖ Error en correr %u reordenes aleatorios\n", num_iteraciones);
         return 0;
     }
+    printf("***************************************************************\n");
+
+    //------------ Test Tabucol ------------------------------------------------
+    error = test_Tabucol(grafo, semilla);
+    if (error) {
+        printf("✖ Error en correr Tabucol\n");
+        return 0;
+    }
+    printf("***************************************************************\n");
+
+    //------------ Test coloreo evolutivo --------------------------------------
+    error = test_Evolutivo(grafo, semilla);
+    if (error) {
+        printf("✖ Error en correr el coloreo evolutivo\n");
+        return 0;
+    }
     DestruccionDelGrafo(grafo);
 	return 0;    
 }